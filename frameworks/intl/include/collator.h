@@ -23,7 +23,7 @@
 #include "unicode/locid.h"
 #include "unicode/coll.h"
 
-#include "locale_info.h"
+#include "locale_handle.h"
 
 namespace OHOS {
 namespace Global {
@@ -35,11 +35,12 @@ typedef enum CompareResult {
     GREATER,
 } CompareResult;
 
+// Compare is const and reentrant, one Collator can be shared between threads.
 class Collator {
 public:
     Collator(std::vector<std::string> &localeTags, std::map<std::string, std::string> &options);
     ~Collator();
-    CompareResult Compare(const std::string &first, const std::string &second);
+    CompareResult Compare(const std::string &first, const std::string &second) const;
     void ResolvedOptions(std::map<std::string, std::string> &options);
 
 private:
@@ -52,7 +53,7 @@ private:
     std::string caseFirst;
     std::string collation;
 
-    std::unique_ptr<LocaleInfo> localeInfo = nullptr;
+    LocaleHandle localeInfo = nullptr;
     icu::Locale locale;
     icu::Collator *collatorPtr = nullptr;
 
@@ -16,10 +16,11 @@
 #define OHOS_GLOBAL_I18N_DATE_TIME_FORMAT_H
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <climits>
 #include <set>
-#include "locale_info.h"
+#include "locale_handle.h"
 #include "unicode/datefmt.h"
 #include "unicode/dtptngen.h"
 #include "unicode/localebuilder.h"
@@ -33,12 +34,17 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// Format and FormatRange are const and work on per-call calendars, one DateTimeFormat can be shared between
+// threads.
 class DateTimeFormat {
 public:
     DateTimeFormat(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &configs);
     virtual ~DateTimeFormat();
-    std::string Format(int64_t *date, size_t size);
-    std::string FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate, size_t toDateSize);
+    std::string Format(int64_t *date, size_t size) const;
+    void Format(int64_t *date, size_t size, icu::UnicodeString &result) const;
+    std::string FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate, size_t toDateSize) const;
+    void FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate, size_t toDateSize,
+        icu::UnicodeString &result) const;
     void GetResolvedOptions(std::map<std::string, std::string> &map);
     std::string GetDateStyle() const;
     std::string GetTimeStyle() const;
@@ -82,7 +88,7 @@ private:
     icu::DateFormat *dateFormat = nullptr;
     icu::DateIntervalFormat *dateIntvFormat = nullptr;
     icu::Calendar *calendar = nullptr;
-    LocaleInfo *localeInfo = nullptr;
+    LocaleHandle localeInfo = nullptr;
     icu::Locale locale;
     icu::UnicodeString pattern;
     char16_t yearChar = 'Y';
@@ -113,8 +119,6 @@ private:
     static const int32_t LONG_ERA_LENGTH = 4;
     static const int HALF_HOUR = 30;
     static const int HOURS_OF_A_DAY = 24;
-    static bool icuInitialized;
-    static bool Init();
     static std::map<std::string, icu::DateFormat::EStyle> dateTimeStyle;
     void InitWithLocale(const std::string &curLocale, std::map<std::string, std::string> &configs);
     void InitWithDefaultLocale(std::map<std::string, std::string> &configs);
@@ -134,7 +138,9 @@ private:
     void FixPatternPartOne();
     void FixPatternPartTwo();
     void removeAmPmChar();
-    int64_t GetArrayValue(int64_t *dateArray, size_t index, size_t size);
+    void InitTimeZone();
+    std::unique_ptr<icu::Calendar> CreateCalendar(int64_t *date, size_t size, UErrorCode &status) const;
+    int64_t GetArrayValue(int64_t *dateArray, size_t index, size_t size) const;
 };
 } // namespace I18n
 } // namespace Global
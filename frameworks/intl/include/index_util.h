@@ -15,6 +15,7 @@
 #ifndef GLOBAL_I18N_STANDARD_INDEX_UTIL_H
 #define GLOBAL_I18N_STANDARD_INDEX_UTIL_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "unicode/alphaindex.h"
@@ -22,16 +23,20 @@
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// GetIndexList and GetIndex are const and read an immutable snapshot of the index, so they can run on several
+// threads at once. AddLocale rebuilds the snapshot and must not run concurrently with them.
 class IndexUtil {
 public:
     IndexUtil(const std::string &localeTag);
     ~IndexUtil();
-    std::vector<std::string> GetIndexList();
+    std::vector<std::string> GetIndexList() const;
     void AddLocale(const std::string &localeTag);
-    std::string GetIndex(const std::string &String);
+    std::string GetIndex(const std::string &String) const;
 
 private:
     std::unique_ptr<icu::AlphabeticIndex> index;
+    std::unique_ptr<icu::AlphabeticIndex::ImmutableIndex> immutableIndex;
+    void BuildImmutableIndex();
 };
 } // namespace I18n
 } // namespace Global
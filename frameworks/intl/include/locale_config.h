@@ -15,15 +15,21 @@
 #ifndef OHOS_GLOBAL_I18N_LOCALE_CONFIG_H
 #define OHOS_GLOBAL_I18N_LOCALE_CONFIG_H
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include "unicode/locid.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+class LocaleConfigSnapshot;
+struct SystemParams;
+
 class LocaleConfig {
 public:
     LocaleConfig() = default;
@@ -34,14 +40,24 @@ public:
     static std::string GetSystemLanguage();
     static std::string GetSystemRegion();
     static std::string GetSystemLocale();
+    // the system locale parsed once per change of the parameters.
+    static icu::Locale GetSystemIcuLocale();
     static void GetSystemLanguages(std::vector<std::string> &ret);
     static void GetSystemCountries(std::vector<std::string> &ret);
     static bool IsSuggested(const std::string &language);
     static bool IsSuggested(const std::string &language, const std::string &region);
+    static void IsSuggested(const std::vector<std::string> &languages, std::vector<bool> &ret);
+    static void IsSuggested(const std::vector<std::string> &languages, const std::string &region,
+        std::vector<bool> &ret);
     static std::string GetDisplayLanguage(const std::string &language, const std::string &displayLocale,
         bool sentenceCase);
     static std::string GetDisplayRegion(const std::string &region, const std::string &displayLocale,
         bool sentenceCase);
+    static void GetDisplayLanguages(const std::vector<std::string> &languages, const std::string &displayLocale,
+        bool sentenceCase, std::vector<std::string> &ret);
+    static void GetDisplayRegions(const std::vector<std::string> &regions, const std::string &displayLocale,
+        bool sentenceCase, std::vector<std::string> &ret);
+    static void GetDisplayNameCacheStats(uint64_t &hits, uint64_t &misses);
     static bool IsRTL(const std::string &locale);
     static std::string GetValidLocale(const std::string &localeTag);
     static bool Is24HourClock();
@@ -73,29 +89,31 @@ private:
     static const char *FORBIDDEN_REGIONS_NAME;
     static const char *FORBIDDEN_LANGUAGES_PATH;
     static const char *FORBIDDEN_LANGUAGES_NAME;
+    static const char *SNAPSHOT_PATH;
 
-    static const std::unordered_set<std::string>& GetSupportedLocales();
-    static const std::unordered_set<std::string>& GetForbiddenRegions();
-    static const std::unordered_set<std::string>& GetSupportedRegions();
+    static const LocaleConfigSnapshot &GetLocaleLists();
+    static std::shared_ptr<const SystemParams> GetSystemParams();
+    static std::shared_ptr<const SystemParams> LoadSystemParams(uint32_t generation);
+    static void WatchSystemParams();
+    static void OnParameterChanged(const char *key, const char *value, void *context);
+    static void InvalidateSystemParams();
+    static std::atomic<uint32_t> paramGeneration;
+    static std::atomic<bool> paramWatched;
+    static std::shared_ptr<const SystemParams> systemParams;
     static void GetCountriesFromSim(std::vector<std::string> &simCountries);
-    static void GetRelatedLocales(std::unordered_set<std::string> &relatedLocales,
-        const std::vector<std::string> countries);
+    static const std::unordered_map<std::string, std::unordered_set<std::string>> &GetSuggestedLanguages();
+    static std::unordered_map<std::string, std::unordered_set<std::string>> InitSuggestedLanguages();
+    static bool IsSuggestedInRegions(const std::string &mainLanguage, const std::vector<std::string> &regions);
     static std::string GetRegionChangeLocale(const std::string &languageTag, const std::string &region);
     static void GetListFromFile(const char *path, const char *resourceName, std::unordered_set<std::string> &ret);
     static void Expunge(std::unordered_set<std::string> &src, const std::unordered_set<std::string> &another);
     static std::string GetMainLanguage(const std::string &language);
-    static std::unordered_set<std::string> supportedLocales;
-    static std::unordered_set<std::string> supportedRegions;
-    static std::unordered_set<std::string> whiteLanguages;
-    static std::unordered_map<std::string, std::string> dialectMap;
-    static std::set<std::string> validCaTag;
-    static std::set<std::string> validCoTag;
-    static std::set<std::string> validKnTag;
-    static std::set<std::string> validKfTag;
-    static std::set<std::string> validNuTag;
-    static std::set<std::string> validHcTag;
-    static bool listsInitialized;
-    static bool InitializeLists();
+    static std::string GetCachedMainLanguage(const std::string &language);
+    static std::string ComputeDisplayLanguage(const std::string &language, const std::string &displayLocale,
+        bool sentenceCase);
+    static std::string ComputeDisplayRegion(const std::string &region, const std::string &displayLocale,
+        bool sentenceCase);
+    static void InitializeLists(LocaleConfigSnapshot &lists);
 };
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LOCALE_CONFIG_SNAPSHOT_H
+#define OHOS_GLOBAL_I18N_LOCALE_CONFIG_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+enum LocaleListType {
+    SUPPORTED_LOCALES,
+    SUPPORTED_REGIONS,
+    WHITE_LANGUAGES,
+    LOCALE_LIST_COUNT
+};
+
+// Sorted string tables of the locale config lists. They are either mapped from the binary snapshot generated
+// by tools/locale_config_snapshot.py at build time, or assigned from the lists parsed out of the xml files.
+class LocaleConfigSnapshot {
+public:
+    LocaleConfigSnapshot() = default;
+    ~LocaleConfigSnapshot();
+    LocaleConfigSnapshot(const LocaleConfigSnapshot &) = delete;
+    LocaleConfigSnapshot &operator=(const LocaleConfigSnapshot &) = delete;
+    bool Load(const char *path, const char * const *sources, uint32_t sourceCount);
+    void Assign(LocaleListType type, std::vector<std::string> &items);
+    uint32_t Size(LocaleListType type) const;
+    std::string_view At(LocaleListType type, uint32_t index) const;
+    bool Contains(LocaleListType type, std::string_view item) const;
+
+private:
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t sourceCount;
+        uint32_t listCount;
+        uint32_t poolOffset;
+        uint32_t poolSize;
+    };
+    // size and fnv-1a hash of the content of a source xml file.
+    struct SourceEntry {
+        uint64_t size;
+        uint64_t hash;
+    };
+    struct ListEntry {
+        uint32_t count;
+        uint32_t tableOffset;
+    };
+    struct ItemEntry {
+        uint32_t offset;
+        uint32_t length;
+    };
+    static constexpr uint32_t SNAPSHOT_VERSION = 2;
+    static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+    static constexpr size_t HASH_BUFFER_SIZE = 4096;
+    bool Validate(const char * const *sources, uint32_t sourceCount);
+    static bool IsSourceUnchanged(const char *path, const SourceEntry &source);
+    void Unmap();
+    void *mapped = nullptr;
+    size_t mappedSize = 0;
+    const ItemEntry *tables[LOCALE_LIST_COUNT] = { nullptr };
+    uint32_t counts[LOCALE_LIST_COUNT] = { 0 };
+    const char *pool = nullptr;
+    std::vector<std::string> lists[LOCALE_LIST_COUNT];
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LOCALE_EXTENSION_H
+#define OHOS_GLOBAL_I18N_LOCALE_EXTENSION_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Single pass tokenizer of the -u- extension of a language tag. Keys and values are views into the tag, which
+// must outlive the tokenizer. A value spans all the subtags up to the next key, e.g. "islamic-umalqura".
+class LocaleExtension {
+public:
+    explicit LocaleExtension(std::string_view localeTag);
+    std::string_view Find(std::string_view key) const;
+    size_t Size() const;
+    std::string_view Key(size_t index) const;
+    std::string_view Value(size_t index) const;
+    static std::string_view GetBaseName(std::string_view localeTag);
+    static constexpr size_t MAX_KEYWORDS = 16;
+    static constexpr size_t KEY_LEN = 2;
+
+private:
+    struct Keyword {
+        std::string_view key;
+        std::string_view value;
+    };
+    Keyword keywords[MAX_KEYWORDS];
+    size_t count = 0;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LOCALE_HANDLE_H
+#define OHOS_GLOBAL_I18N_LOCALE_HANDLE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include "locale_info.h"
+#include "lru_cache.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Immutable parsed locale shared by every formatter created for the same tag and locale options.
+using LocaleHandle = std::shared_ptr<const LocaleInfo>;
+
+class LocaleRegistry {
+public:
+    static LocaleHandle Acquire(const std::string &localeTag, std::map<std::string, std::string> &configs);
+    static size_t Size();
+    static void Clear();
+    // At most this many parsed locales are kept, the least recently acquired one is evicted first.
+    static const size_t CAPACITY = 64;
+
+private:
+    static LruCache<std::string, LocaleHandle> &GetHandles();
+    static std::string ComputeKey(const std::string &localeTag, const std::map<std::string, std::string> &configs);
+    static const char *LOCALE_OPTIONS[];
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
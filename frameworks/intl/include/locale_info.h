@@ -15,8 +15,8 @@
 #ifndef OHOS_GLOBAL_I18N_LOCALE_INFO_H
 #define OHOS_GLOBAL_I18N_LOCALE_INFO_H
 
+#include <bitset>
 #include <map>
-#include <set>
 #include "unicode/locid.h"
 #include "unicode/localebuilder.h"
 #include "unicode/stringpiece.h"
@@ -46,35 +46,35 @@ public:
     icu::Locale GetLocaleTag() const;
     static const uint32_t SCRIPT_LEN = 4;
     static const uint32_t REGION_LEN = 2;
-    static std::set<std::string> allValidLocales;
-    static std::set<std::string> GetValidLocales();
+    static bool IsValidLanguage(const char *language);
+    static const uint32_t LANGUAGE_SPACE = 27 * 27 * 27;
 private:
+    enum ExtensionField {
+        HOUR_CYCLE,
+        NUMBERING_SYSTEM,
+        CALENDAR,
+        COLLATION,
+        CASE_FIRST,
+        NUMERIC,
+        EXTENSION_FIELD_COUNT
+    };
+    // position of an extension value inside finalLocaleTag.
+    struct Span {
+        uint32_t begin = 0;
+        uint32_t length = 0;
+    };
     std::string language;
     std::string region;
     std::string script;
     std::string baseName;
-    std::string calendar;
-    std::string collation;
-    std::string hourCycle;
-    std::string numberingSystem;
-    std::string numeric;
-    std::string caseFirst;
     std::string finalLocaleTag;
-    std::string localeTag;
+    Span extensions[EXTENSION_FIELD_COUNT];
     icu::Locale locale;
-    std::string calendarTag = "-ca-";
-    std::string collationTag = "-co-";
-    std::string hourCycleTag = "-hc-";
-    std::string numberingSystemTag = "-nu-";
-    std::string numericTag = "-kn-";
-    std::string caseFirstTag = "-kf-";
-    static bool icuInitialized;
-    static bool Init();
-    static const uint32_t CONFIG_TAG_LEN = 4;
-    std::map<std::string, std::string> configs;
-    void ComputeFinalLocaleTag(const std::string &localeTag);
-    void ParseConfigs();
-    void ParseLocaleTag(const std::string &localeTag);
+    static const std::bitset<LANGUAGE_SPACE> &GetValidLanguages();
+    static std::bitset<LANGUAGE_SPACE> InitValidLanguages();
+    static uint32_t EncodeLanguage(const char *language);
+    std::string GetExtension(ExtensionField field) const;
+    void ComputeFinalLocaleTag(const std::string &localeTag, const std::map<std::string, std::string> *configs);
 };
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LOCALE_TABLES_H
+#define OHOS_GLOBAL_I18N_LOCALE_TABLES_H
+
+#include "sorted_table.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// dialects of LocaleConfig::GetMainLanguage, keyed by the full language tag.
+inline constexpr TableEntry DIALECT_MAP[] = {
+    { "en-Latn-US", "en-Latn-US" },
+    { "es-Latn-419", "es-Latn-419" },
+    { "es-Latn-BO", "es-Latn-419" },
+    { "es-Latn-BR", "es-Latn-419" },
+    { "es-Latn-BZ", "es-Latn-419" },
+    { "es-Latn-CL", "es-Latn-419" },
+    { "es-Latn-CO", "es-Latn-419" },
+    { "es-Latn-CR", "es-Latn-419" },
+    { "es-Latn-CU", "es-Latn-419" },
+    { "es-Latn-DO", "es-Latn-419" },
+    { "es-Latn-EC", "es-Latn-419" },
+    { "es-Latn-GT", "es-Latn-419" },
+    { "es-Latn-HN", "es-Latn-419" },
+    { "es-Latn-MX", "es-Latn-419" },
+    { "es-Latn-NI", "es-Latn-419" },
+    { "es-Latn-PA", "es-Latn-419" },
+    { "es-Latn-PE", "es-Latn-419" },
+    { "es-Latn-PR", "es-Latn-419" },
+    { "es-Latn-PY", "es-Latn-419" },
+    { "es-Latn-SV", "es-Latn-419" },
+    { "es-Latn-US", "es-Latn-419" },
+    { "es-Latn-UY", "es-Latn-419" },
+    { "es-Latn-VE", "es-Latn-419" },
+    { "pt-Latn-PT", "pt-Latn-PT" },
+};
+static_assert(IsSortedTable(DIALECT_MAP), "DIALECT_MAP must be sorted");
+
+// display names of these languages are looked up with the adjusted tag, matched by prefix.
+inline constexpr TableEntry LANGUAGE_MAP[] = {
+    { "az-Latn", "az-Latn" },
+    { "bs-Latn", "bs-Latn" },
+    { "en-Qaag", "en-Qaag" },
+    { "es-Latn-419", "es-419" },
+    { "es-Latn-US", "es-419" },
+    { "jv-Latn", "jv-Latn" },
+    { "mai-Deva", "mai-Deva" },
+    { "my-Qaag", "my-Qaag" },
+    { "pa-Guru", "pa-Guru" },
+    { "pt-Latn-BR", "pt-BR" },
+    { "sr-Latn", "sr-Latn" },
+    { "uz-Latn", "uz-Latn" },
+    { "zh-Hans", "zh-Hans" },
+    { "zh-Hant", "zh-Hant" },
+};
+static_assert(IsSortedTable(LANGUAGE_MAP) && IsPrefixFreeTable(LANGUAGE_MAP), "LANGUAGE_MAP must be sorted");
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
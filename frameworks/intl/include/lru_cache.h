@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_LRU_CACHE_H
+#define OHOS_GLOBAL_I18N_LRU_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Bounded least-recently-used cache guarded by a mutex, counting hits and misses.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity) : capacity(capacity) {}
+    LruCache(const LruCache &) = delete;
+    LruCache &operator=(const LruCache &) = delete;
+
+    bool Get(const Key &key, Value &value)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto iter = index.find(key);
+        if (iter == index.end()) {
+            misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        entries.splice(entries.begin(), entries, iter->second);
+        value = iter->second->second;
+        hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void Put(const Key &key, const Value &value)
+    {
+        if (!capacity) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        auto iter = index.find(key);
+        if (iter != index.end()) {
+            iter->second->second = value;
+            entries.splice(entries.begin(), entries, iter->second);
+            return;
+        }
+        if (index.size() >= capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(key, value);
+        index.emplace(key, entries.begin());
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        index.clear();
+        entries.clear();
+    }
+
+    size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        return index.size();
+    }
+
+    uint64_t GetHits() const
+    {
+        return hits.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetMisses() const
+    {
+        return misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    using Entry = std::pair<Key, Value>;
+    size_t capacity;
+    std::mutex mtx;
+    std::list<Entry> entries;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+    std::atomic<uint64_t> hits { 0 };
+    std::atomic<uint64_t> misses { 0 };
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -17,22 +17,59 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include "unicode/measunit.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
-uint32_t GetMask(const std::string &region);
-void GetDefaultPreferredUnit(const std::string &region, const std::string &type, std::vector<std::string> &units);
-void GetFallbackPreferredUnit(const std::string &region, const std::string &usage, std::vector<std::string> &units);
-void GetRestPreferredUnit(const std::string &region, const std::string &usage, std::vector<std::string> &units);
-void GetPreferredUnit(const std::string &region, const std::string &usage, std::vector<std::string> &units);
+// base = factor * value + offset converts a value of a unit into the base unit of its type.
+struct UnitConversion {
+    uint32_t typeId;
+    double factor;
+    double offset;
+};
+
+// unit preferences of CLDR, compiled from etc/unit_preferences.xml into unit_preferences_data.h.
+struct UnitPreference {
+    std::string_view unit;
+    double geq;
+    // rounding increment of the unit, 0 when CLDR gives no skeleton for it.
+    double increment;
+};
+
+struct UnitPreferenceRow {
+    std::string_view usage;
+    std::string_view region;
+    uint32_t first;
+    uint32_t count;
+};
+
+// units[0, count) of the static preference table, from the largest unit to the smallest.
+struct UnitPreferences {
+    const UnitPreference *units;
+    size_t count;
+};
+
+// usage is a category joined with a usage, like length-person-height or length-default.
+UnitPreferences GetUnitPreferences(const std::string &region, const std::string &usage);
+// mixed units like foot-and-inch are split into the units they are made of, a single unit is returned as is.
+void SplitMixedUnit(std::string_view unit, std::vector<std::string> &units);
 void ComputeFactorValue(const std::string &unit, const std::string &measSys, std::vector<double> &factors);
 double ComputeSIPrefixValue(const std::string &unit);
 void ComputePowerValue(const std::string &unit, const std::string &measSys, std::vector<double> &factors);
 int ComputeValue(const std::string &unit, const std::string &measSys, std::vector<double> &factors);
+const std::unordered_map<std::string, icu::MeasureUnit> &GetMeasureUnits();
+const icu::MeasureUnit *FindMeasureUnit(const std::string &subtype);
+const UnitConversion *FindUnitConversion(const std::string &unit, const std::string &measSys);
+// from and to must be conversions of the same type.
+double ApplyUnitConversion(double value, const UnitConversion &from, const UnitConversion &to);
 int Convert(double &value, const std::string &fromUnit, const std::string &fromMeasSys, const std::string &toUnit,
     const std::string &toMeasSys);
+// Converts count values like Convert, out may be the same array as in but must not overlap it otherwise.
+int ConvertBatch(const double *in, double *out, size_t count, const std::string &fromUnit,
+    const std::string &fromMeasSys, const std::string &toUnit, const std::string &toMeasSys);
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_MIXED_UNIT_FORMAT_H
+#define OHOS_GLOBAL_I18N_MIXED_UNIT_FORMAT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "unicode/listformatter.h"
+#include "unicode/locid.h"
+#include "unicode/numberformatter.h"
+#include "unicode/unistr.h"
+#include "measure_data.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Formats a value across the units of the unit preferences of a usage when one of them is a mixed unit, such as
+// foot-and-inch, or is rounded to an increment, the way icu formats a usage: "5 ft, 11 in", "50 ft". The factors
+// splitting a value into the integral leading units and the remainder of the last unit, and a formatter of every unit,
+// are prepared once, so a value costs one format per unit and one list format.
+class MixedUnitFormat {
+public:
+    // Returns nullptr when no preference is a mixed unit or has an increment, or a unit of the preferences is not of
+    // the type of unit or is not a linear conversion of its base unit. formatter carries the options shared by every
+    // unit. With cldrPrecision, the last unit is rounded like icu rounds a usage without precision, to the increment
+    // of the preference, otherwise to an integer keeping two significant digits. Without it, the precision of
+    // formatter is kept and increments are ignored.
+    static std::shared_ptr<const MixedUnitFormat> Create(const icu::Locale &locale, const UnitPreferences &preferences,
+        const std::string &unit, const std::string &measSys, const icu::number::LocalizedNumberFormatter &formatter,
+        UNumberUnitWidth width, bool cldrPrecision);
+    // number is a value of unit. Returns false, leaving result untouched, when it is not finite.
+    bool Format(double number, icu::UnicodeString &result) const;
+    // Formats number into the value of each of count units in items, joined in list. The span of items[i] in list
+    // is the UFIELD_CATEGORY_LIST_SPAN position of field i.
+    bool FormatToValue(double number, icu::number::FormattedNumber *items, size_t &count,
+        icu::FormattedList &list) const;
+    // Rounding of icu for a usage without precision: to increment when it is positive, otherwise to an integer
+    // keeping two significant digits.
+    static icu::number::Precision GetCldrPrecision(double increment);
+    static const size_t MAX_COMPONENTS = 4;
+
+private:
+    struct Component {
+        // units of this component in one unit of the previous one, base units in one unit for the first component.
+        double ratio;
+        std::shared_ptr<const icu::number::LocalizedNumberFormatter> numberFormat;
+    };
+    struct Preference {
+        double geq;
+        std::vector<Component> components;
+    };
+    MixedUnitFormat() = default;
+    static bool InitPreference(const UnitPreference &unit, uint32_t typeId, const std::string &measSys,
+        const icu::number::LocalizedNumberFormatter &formatter, bool cldrPrecision, Preference &preference);
+    UnitConversion conversion;
+    std::vector<Preference> preferences;
+    std::unique_ptr<icu::ListFormatter> listFormat;
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_NOTATION_PATTERNS_H
+#define OHOS_GLOBAL_I18N_NOTATION_PATTERNS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "unicode/locid.h"
+#include "unicode/numberformatter.h"
+#include "unicode/plurrule.h"
+#include "unicode/unistr.h"
+#include "lru_cache.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Precomputed standard, compact and scientific notation patterns of one locale. The affixes and grouping of every
+// power of ten and plural form are taken from the icu formatter of the notation once, after which integral numbers
+// are formatted with integer arithmetic only. Every entry is checked against icu when it is built, entries icu renders
+// differently are left out and those numbers are formatted by icu instead.
+class NotationPatterns {
+public:
+    enum NotationType {
+        COMPACT_SHORT,
+        COMPACT_LONG,
+        SCIENTIFIC,
+        ENGINEERING,
+        STANDARD
+    };
+    NotationPatterns(const icu::Locale &locale, NotationType type);
+    static std::shared_ptr<const NotationPatterns> Acquire(const icu::Locale &locale, NotationType type);
+    // Returns false, leaving result untouched, when number is not handled by the patterns.
+    bool Format(double number, icu::UnicodeString &result) const;
+    // Numbers from -MAX_VALUE to MAX_VALUE, exclusive, may be formatted by the patterns.
+    static constexpr double MAX_VALUE = 1e15;
+    static const size_t CAPACITY = 32;
+    // Longest digits and grouping separators of a standard number, in utf-16 code units.
+    static const int32_t MAX_STANDARD_LENGTH = 64;
+
+private:
+    struct Affixes {
+        bool valid = false;
+        icu::UnicodeString prefix;
+        icu::UnicodeString suffix;
+        icu::UnicodeString negativePrefix;
+        icu::UnicodeString negativeSuffix;
+    };
+    // a rounded number, digits / 10^fractionDigits, scaled by 10^multiplier from the input.
+    struct Rounded {
+        uint64_t digits;
+        int32_t fractionDigits;
+        int32_t multiplier;
+    };
+    static const int32_t MAX_MAGNITUDE = 14;
+    static const int32_t INVALID_MULTIPLIER = -1000;
+    static const uint32_t INVALID_GROUPING = 1U << 31;
+    static const int32_t MAX_SCIENTIFIC_FRACTION = 6;
+    static const int32_t ZERO_CLASS = 0;
+    static const int32_t ONE_CLASS = 1;
+    static const int32_t KEYWORD_CLASS_BASE = 2;
+    static LruCache<std::string, std::shared_ptr<const NotationPatterns>> &GetPatterns();
+    void InitCompact(const icu::number::LocalizedNumberFormatter &formatter);
+    void InitCompactMagnitude(const icu::number::LocalizedNumberFormatter &formatter, int32_t magnitude);
+    void InitScientific(const icu::number::LocalizedNumberFormatter &formatter);
+    void InitStandard(const icu::number::LocalizedNumberFormatter &formatter);
+    uint32_t ProbeGrouping(const icu::number::LocalizedNumberFormatter &formatter, int32_t magnitude) const;
+    bool ProbeAffixes(const icu::number::LocalizedNumberFormatter &formatter, double number,
+        const icu::UnicodeString &core, Affixes &affixes) const;
+    bool SelfCheck(const icu::number::LocalizedNumberFormatter &formatter) const;
+    static int32_t GetMagnitude(const Rounded &rounded);
+    int32_t GetMultiplier(int32_t magnitude) const;
+    Rounded Round(uint64_t value, int32_t multiplier) const;
+    Rounded ChooseMultiplierAndRound(uint64_t value) const;
+    int32_t GetPluralClass(uint64_t digits, int32_t fractionDigits) const;
+    void AppendDecimal(uint64_t digits, int32_t fractionDigits, icu::UnicodeString &result) const;
+    bool FormatCompact(uint64_t value, bool negative, icu::UnicodeString &result) const;
+    bool FormatScientific(uint64_t value, bool negative, icu::UnicodeString &result) const;
+    bool FormatStandard(uint64_t value, bool negative, icu::UnicodeString &result) const;
+    NotationType type;
+    bool valid = false;
+    icu::UnicodeString digitSymbols[10];
+    icu::UnicodeString decimalSeparator;
+    icu::UnicodeString exponentSymbol;
+    icu::UnicodeString groupingSeparator;
+    std::unique_ptr<icu::PluralRules> pluralRules;
+    std::vector<icu::UnicodeString> keywords;
+    // multiplier icu applies to numbers of every magnitude, greater magnitudes use the one of MAX_MAGNITUDE.
+    int32_t multipliers[MAX_MAGNITUDE + 1] = { 0 };
+    // affixes of every magnitude and plural class, with the plural class as the inner index.
+    std::vector<Affixes> compactAffixes;
+    // for magnitudes whose plural classes all share the same affixes, the class holding them, otherwise -1.
+    int32_t uniformClasses[MAX_MAGNITUDE + 1] = { 0 };
+    // affixes of the standard and scientific notations, which are the same for every number.
+    Affixes plainAffixes;
+    // for numbers of every magnitude, bit i is set when a grouping separator precedes the last i digits.
+    uint32_t groupingMasks[MAX_MAGNITUDE + 1] = { 0 };
+};
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -16,6 +16,7 @@
 #define OHOS_GLOBAL_I18N_NUMBER_FORMAT_H
 
 #include <map>
+#include <memory>
 #include <set>
 #include <unordered_map>
 #include <vector>
@@ -35,17 +36,90 @@
 #include "unicode/ulocdata.h"
 #include "number_utils.h"
 #include "number_utypes.h"
-#include "locale_info.h"
+#include "locale_handle.h"
 #include "measure_data.h"
+#include "mixed_unit_format.h"
+#include "notation_patterns.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// span [begin, end) of the formatted number holding the icu UNumberFormatFields field.
+struct NumberFormatPart {
+    int32_t field;
+    int32_t begin;
+    int32_t end;
+};
+
+// options of NumberFormat in typed form. Keyword options hold the index of their keyword and are *_UNSET when not
+// given or not recognized, digit options hold UNSET_DIGITS when not given.
+struct NumberFormatOptions {
+    enum Style : uint8_t { STYLE_UNSET, STYLE_DECIMAL, STYLE_PERCENT, STYLE_CURRENCY, STYLE_UNIT };
+    enum CurrencySign : uint8_t { CURRENCY_SIGN_UNSET, CURRENCY_SIGN_STANDARD, CURRENCY_SIGN_ACCOUNTING };
+    enum CurrencyDisplay : uint8_t {
+        CURRENCY_DISPLAY_UNSET,
+        CURRENCY_DISPLAY_SYMBOL,
+        CURRENCY_DISPLAY_CODE,
+        CURRENCY_DISPLAY_NAME,
+        CURRENCY_DISPLAY_NARROW_SYMBOL
+    };
+    enum UnitDisplay : uint8_t { UNIT_DISPLAY_UNSET, UNIT_DISPLAY_SHORT, UNIT_DISPLAY_LONG, UNIT_DISPLAY_NARROW };
+    enum SignDisplay : uint8_t {
+        SIGN_DISPLAY_UNSET,
+        SIGN_DISPLAY_AUTO,
+        SIGN_DISPLAY_NEVER,
+        SIGN_DISPLAY_ALWAYS,
+        SIGN_DISPLAY_EXCEPT_ZERO
+    };
+    enum Notation : uint8_t {
+        NOTATION_UNSET,
+        NOTATION_STANDARD,
+        NOTATION_SCIENTIFIC,
+        NOTATION_ENGINEERING,
+        NOTATION_COMPACT
+    };
+    enum CompactDisplay : uint8_t { COMPACT_DISPLAY_UNSET, COMPACT_DISPLAY_SHORT, COMPACT_DISPLAY_LONG };
+    enum LocaleMatcher : uint8_t { LOCALE_MATCHER_UNSET, LOCALE_MATCHER_LOOKUP, LOCALE_MATCHER_BEST_FIT };
+    enum UseGrouping : uint8_t { USE_GROUPING_UNSET, USE_GROUPING_TRUE, USE_GROUPING_FALSE };
+    static const int32_t UNSET_DIGITS = -1;
+
+    // sets the option called name from its string form, returns false if name is not a NumberFormat option.
+    bool SetOption(const char *name, const std::string &value);
+    bool SetDigitsOption(const char *name, int32_t value);
+
+    Style style = STYLE_UNSET;
+    CurrencySign currencySign = CURRENCY_SIGN_UNSET;
+    CurrencyDisplay currencyDisplay = CURRENCY_DISPLAY_UNSET;
+    UnitDisplay unitDisplay = UNIT_DISPLAY_UNSET;
+    SignDisplay signDisplay = SIGN_DISPLAY_UNSET;
+    Notation notation = NOTATION_UNSET;
+    CompactDisplay compactDisplay = COMPACT_DISPLAY_UNSET;
+    LocaleMatcher localeMatcher = LOCALE_MATCHER_UNSET;
+    UseGrouping useGrouping = USE_GROUPING_UNSET;
+    int32_t minimumIntegerDigits = UNSET_DIGITS;
+    int32_t minimumFractionDigits = UNSET_DIGITS;
+    int32_t maximumFractionDigits = UNSET_DIGITS;
+    int32_t minimumSignificantDigits = UNSET_DIGITS;
+    int32_t maximumSignificantDigits = UNSET_DIGITS;
+    std::string currency;
+    std::string unit;
+    std::string unitUsage;
+    std::string numberingSystem;
+};
+
+// The Format family is const and reentrant, one NumberFormat can be shared between threads.
 class NumberFormat {
 public:
+    NumberFormat(const std::vector<std::string> &localeTags, const NumberFormatOptions &formatOptions);
     NumberFormat(const std::vector<std::string> &localeTag, std::map<std::string, std::string> &configs);
     virtual ~NumberFormat();
-    std::string Format(double number);
+    std::string Format(double number) const;
+    void Format(double number, icu::UnicodeString &result) const;
+    void FormatToParts(double number, icu::UnicodeString &formatted, std::vector<NumberFormatPart> &parts) const;
+    static const char *GetPartType(const icu::UnicodeString &formatted, const NumberFormatPart &part);
+    static constexpr int32_t LITERAL_FIELD = -1;
+    // Formats count numbers into one utf-8 arena, the i-th result is arena[offsets[i], offsets[i + 1]).
+    void FormatBatch(const double *numbers, size_t count, std::string &arena, std::vector<size_t> &offsets) const;
     void GetResolvedOptions(std::map<std::string, std::string> &map);
     std::string GetCurrency() const;
     std::string GetCurrencySign() const;
@@ -58,51 +132,53 @@ public:
     std::string GetMinimumSignificantDigits() const;
     std::string GetMaximumSignificantDigits() const;
     std::string GetLocaleMatcher() const;
+    static void GetFormatterCacheStats(uint64_t &hits, uint64_t &misses);
 
 private:
+    // candidate of unitUsage with the factors converting a base value into it, see Convert in measure_data.
+    struct PreferredUnit {
+        double factor;
+        double offset;
+        std::shared_ptr<const icu::number::LocalizedNumberFormatter> numberFormat;
+    };
+    // fully configured formatter shared by every NumberFormat created with the same locales and options.
+    struct CachedFormatter {
+        LocaleHandle localeInfo;
+        std::shared_ptr<const icu::number::LocalizedNumberFormatter> numberFormat;
+        std::vector<double> unitFactors;
+        std::vector<PreferredUnit> preferredUnits;
+        std::shared_ptr<const NotationPatterns> notationPatterns;
+        std::shared_ptr<const MixedUnitFormat> mixedUnitFormat;
+    };
     icu::Locale locale;
-    std::string currency;
-    std::string currencySign;
-    std::string currencyDisplayString;
-    std::string unit;
-    std::string unitDisplayString;
-    std::string styleString;
-    std::string numberingSystem;
-    std::string useGrouping;
-    std::string notationString;
-    std::string signDisplayString;
-    std::string compactDisplay;
-    std::string minimumIntegerDigits;
-    std::string minimumFractionDigits;
-    std::string maximumFractionDigits;
-    std::string minimumSignificantDigits;
-    std::string maximumSignificantDigits;
+    NumberFormatOptions options;
     std::string localeBaseName;
-    std::string localeMatcher;
-    std::string unitUsage;
     std::string unitType;
     std::string unitMeasSys;
-    LocaleInfo *localeInfo = nullptr;
-    icu::number::LocalizedNumberFormatter numberFormat;
-    icu::number::Notation notation = icu::number::Notation::simple();
-    UNumberUnitWidth unitDisplay = UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT;
-    UNumberUnitWidth currencyDisplay = UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT;
-    UNumberSignDisplay signDisplay = UNumberSignDisplay::UNUM_SIGN_AUTO;
-    static const int MAX_UNIT_NUM = 500;
+    LocaleHandle localeInfo = nullptr;
+    std::shared_ptr<const icu::number::LocalizedNumberFormatter> numberFormat;
+    std::vector<double> unitFactors;
+    std::vector<PreferredUnit> preferredUnits;
+    // integral numbers are formatted with it when it is set, see InitNotationPatterns.
+    std::shared_ptr<const NotationPatterns> notationPatterns;
+    // set when a preference of unitUsage is a mixed unit or has a rounding increment, Format then follows the
+    // preferences the way icu does.
+    std::shared_ptr<const MixedUnitFormat> mixedUnitFormat;
     static const int DEFAULT_FRACTION_DIGITS = 3;
-    icu::MeasureUnit unitArray[MAX_UNIT_NUM];
-    static bool icuInitialized;
-    static bool Init();
-    static std::unordered_map<std::string, UNumberUnitWidth> unitStyle;
-    static std::unordered_map<std::string, UNumberUnitWidth> currencyStyle;
-    static std::unordered_map<std::string, UNumberSignDisplay> signAutoStyle;
-    static std::unordered_map<std::string, UNumberSignDisplay> signAccountingStyle;
     static std::unordered_map<UMeasurementSystem, std::string> measurementSystem;
-    void ParseConfigs(std::map<std::string, std::string> &configs);
-    void ParseDigitsConfigs(std::map<std::string, std::string> &configs);
+    void Init(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &localeConfigs);
+    void ResolveOptions();
+    UNumberSignDisplay GetSignDisplay() const;
+    icu::number::Notation GetNotation() const;
     void GetDigitsResolvedOptions(std::map<std::string, std::string> &map);
-    void InitProperties();
-    void InitDigitsProperties();
+    void InitProperties(icu::number::LocalizedNumberFormatter &formatter);
+    void InitDigitsProperties(icu::number::LocalizedNumberFormatter &formatter);
+    void InitPreferredUnits();
+    void InitNotationPatterns();
+    icu::number::FormattedNumber FormatToValue(double number, UErrorCode &status) const;
+    static LruCache<std::string, CachedFormatter> &GetFormatterCache();
+    std::string ComputeCacheKey(const std::vector<std::string> &localeTags,
+        const std::map<std::string, std::string> &localeConfigs) const;
 };
 } // namespace I18n
 } // namespace Global
@@ -24,20 +24,21 @@
 #include "unicode/plurrule.h"
 #include "unicode/numberformatter.h"
 
-#include "locale_info.h"
+#include "locale_handle.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// Select is const and reentrant, one PluralRules can be shared between threads.
 class PluralRules {
 public:
     PluralRules(std::vector<std::string> &localeTags, std::map<std::string, std::string> &options);
     ~PluralRules();
-    std::string Select(double number);
+    std::string Select(double number) const;
 
 private:
     std::string localeStr;
-    std::unique_ptr<LocaleInfo> localeInfo = nullptr;
+    LocaleHandle localeInfo = nullptr;
     icu::Locale locale;
     icu::PluralRules *pluralRules = nullptr;
     icu::number::LocalizedNumberFormatter numberFormatter;
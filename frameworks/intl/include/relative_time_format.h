@@ -39,18 +39,20 @@
 #include "unicode/ureldatefmt.h"
 #include "number_utils.h"
 #include "number_utypes.h"
-#include "locale_info.h"
+#include "locale_handle.h"
 #include "measure_data.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
+// Format and FormatToParts are const and reentrant, one RelativeTimeFormat can be shared between threads.
 class RelativeTimeFormat {
 public:
     RelativeTimeFormat(const std::vector<std::string> &localeTag, std::map<std::string, std::string> &configs);
     virtual ~RelativeTimeFormat();
-    std::string Format(double number, const std::string &unit);
-    void FormatToParts(double number, const std::string &unit, std::vector<std::vector<std::string>> &timeVector);
+    std::string Format(double number, const std::string &unit) const;
+    void FormatToParts(double number, const std::string &unit,
+        std::vector<std::vector<std::string>> &timeVector) const;
     void GetResolvedOptions(std::map<std::string, std::string> &map);
 
 private:
@@ -59,16 +61,16 @@ private:
     std::string styleString = "long";
     std::string numeric = "always";
     std::string numberingSystem;
-    std::unique_ptr<LocaleInfo> localeInfo;
+    LocaleHandle localeInfo;
     std::unique_ptr<icu::RelativeDateTimeFormatter> relativeTimeFormat;
     UDateRelativeDateTimeFormatterStyle style = UDAT_STYLE_LONG;
     static std::unordered_map<std::string, URelativeDateTimeUnit> relativeUnits;
     static std::unordered_map<std::string, UDateRelativeDateTimeFormatterStyle> relativeFormatStyle;
     void InsertInfo(std::vector<std::vector<std::string>> &timeVector, const std::string &unit, bool isInteger,
-        const std::string &value);
+        const std::string &value) const;
     void ProcessIntegerField(const std::map<size_t, size_t> &indexMap,
         std::vector<std::vector<std::string>> &timeVector, size_t &startIndex, const std::string &unit,
-        const std::string &result);
+        const std::string &result) const;
     void ParseConfigs(std::map<std::string, std::string> &configs);
 };
 } // namespace I18n
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_GLOBAL_I18N_SORTED_TABLE_H
+#define OHOS_GLOBAL_I18N_SORTED_TABLE_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// Helpers for constant lookup tables kept as sorted arrays, so they need no construction at library load.
+template<size_t N>
+constexpr bool IsSortedTable(const std::string_view (&table)[N])
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (!(table[i - 1] < table[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<size_t N>
+constexpr bool TableContains(const std::string_view (&table)[N], std::string_view value)
+{
+    size_t low = 0;
+    size_t high = N;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (table[mid] < value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < N && table[low] == value;
+}
+
+struct TableEntry {
+    std::string_view key;
+    std::string_view value;
+};
+
+template<size_t N>
+constexpr bool IsSortedTable(const TableEntry (&table)[N])
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (!(table[i - 1].key < table[i].key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the value of key, or an empty view when the table has no such key.
+template<size_t N>
+constexpr std::string_view TableFind(const TableEntry (&table)[N], std::string_view key)
+{
+    size_t low = 0;
+    size_t high = N;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (table[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return (low < N && table[low].key == key) ? table[low].value : std::string_view();
+}
+
+// No key may be a prefix of another one, so the only candidate is the greatest key not after text.
+template<size_t N>
+constexpr bool IsPrefixFreeTable(const TableEntry (&table)[N])
+{
+    for (size_t i = 1; i < N; ++i) {
+        if (table[i].key.substr(0, table[i - 1].key.size()) == table[i - 1].key) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the value of the key that text starts with, or an empty view when there is none.
+template<size_t N>
+constexpr std::string_view TableFindPrefix(const TableEntry (&table)[N], std::string_view text)
+{
+    size_t low = 0;
+    size_t high = N;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (table[mid].key <= text) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low > 0 && text.substr(0, table[low - 1].key.size()) == table[low - 1].key) {
+        return table[low - 1].value;
+    }
+    return std::string_view();
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
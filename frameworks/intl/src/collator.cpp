@@ -18,6 +18,7 @@
 
 #include "unicode/ucol.h"
 #include "unicode/errorcode.h"
+#include "icu_data.h"
 #include "unicode/uloc.h"
 #include "locale_config.h"
 
@@ -63,6 +64,7 @@ void Collator::ParseAllOptions(std::map<std::string, std::string> &options)
 
 Collator::Collator(std::vector<std::string> &localeTags, std::map<std::string, std::string> &options)
 {
+    InitIcuData();
     ParseAllOptions(options);
 
     UErrorCode status = UErrorCode::U_ZERO_ERROR;
@@ -72,8 +74,8 @@ Collator::Collator(std::vector<std::string> &localeTags, std::map<std::string, s
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = icu::Locale::forLanguageTag(icu::StringPiece(curLocale), status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
-            localeInfo = std::make_unique<LocaleInfo>(curLocale, options);
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
+            localeInfo = LocaleRegistry::Acquire(curLocale, options);
             locale = localeInfo->GetLocale();
             localeStr = localeInfo->GetBaseName();
             bool createSuccess = InitCollator();
@@ -233,7 +235,7 @@ Collator::~Collator()
     }
 }
 
-CompareResult Collator::Compare(const std::string &first, const std::string &second)
+CompareResult Collator::Compare(const std::string &first, const std::string &second) const
 {
     if (!collatorPtr) {
         return CompareResult::INVALID;
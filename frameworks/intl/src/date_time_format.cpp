@@ -15,7 +15,7 @@
 #include "date_time_format.h"
 #include <algorithm>
 #include <cmath>
-#include "ohos/init_data.h"
+#include "icu_data.h"
 #include "locale_config.h"
 
 namespace OHOS {
@@ -23,8 +23,6 @@ namespace Global {
 namespace I18n {
 using namespace icu;
 
-bool DateTimeFormat::icuInitialized = DateTimeFormat::Init();
-
 std::map<std::string, DateFormat::EStyle> DateTimeFormat::dateTimeStyle = {
     { "full", DateFormat::EStyle::kFull },
     { "long", DateFormat::EStyle::kLong },
@@ -34,6 +32,7 @@ std::map<std::string, DateFormat::EStyle> DateTimeFormat::dateTimeStyle = {
 
 DateTimeFormat::DateTimeFormat(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &configs)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
     builder = std::make_unique<LocaleBuilder>();
@@ -41,11 +40,15 @@ DateTimeFormat::DateTimeFormat(const std::vector<std::string> &localeTags, std::
     ParseConfigsPartTwo(configs);
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
-        locale = Locale::forLanguageTag(StringPiece(curLocale), status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
+        // the system locale is parsed once by LocaleConfig.
+        if (curLocale == LocaleConfig::GetSystemLocale()) {
+            locale = LocaleConfig::GetSystemIcuLocale();
+        } else {
+            locale = Locale::forLanguageTag(StringPiece(curLocale), status);
+        }
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
             InitWithLocale(curLocale, configs);
             if (!dateFormat) {
-                delete localeInfo;
                 localeInfo = nullptr;
                 continue;
             }
@@ -55,6 +58,7 @@ DateTimeFormat::DateTimeFormat(const std::vector<std::string> &localeTags, std::
     if (!localeInfo || !dateFormat) {
         InitWithDefaultLocale(configs);
     }
+    InitTimeZone();
 }
 
 DateTimeFormat::~DateTimeFormat()
@@ -71,16 +75,12 @@ DateTimeFormat::~DateTimeFormat()
         delete dateFormat;
         dateFormat = nullptr;
     }
-    if (localeInfo != nullptr) {
-        delete localeInfo;
-        localeInfo = nullptr;
-    }
 }
 
 void DateTimeFormat::InitWithLocale(const std::string &curLocale, std::map<std::string, std::string> &configs)
 {
     UErrorCode status = U_ZERO_ERROR;
-    localeInfo = new LocaleInfo(curLocale, configs);
+    localeInfo = LocaleRegistry::Acquire(curLocale, configs);
     locale = localeInfo->GetLocale();
     localeTag = localeInfo->GetBaseName();
     if (hourCycle.empty()) {
@@ -104,10 +104,7 @@ void DateTimeFormat::InitWithLocale(const std::string &curLocale, std::map<std::
 
 void DateTimeFormat::InitWithDefaultLocale(std::map<std::string, std::string> &configs)
 {
-    if (localeInfo != nullptr) {
-        delete localeInfo;
-        localeInfo = nullptr;
-    }
+    localeInfo = nullptr;
     if (dateFormat != nullptr) {
         delete dateFormat;
         dateFormat = nullptr;
@@ -434,7 +431,7 @@ void DateTimeFormat::ComputeWeekdayOrEraOfPattern(std::string option, char16_t c
     }
 }
 
-int64_t DateTimeFormat::GetArrayValue(int64_t *dateArray, size_t index, size_t size)
+int64_t DateTimeFormat::GetArrayValue(int64_t *dateArray, size_t index, size_t size) const
 {
     if (index < size) {
         return dateArray[index];
@@ -443,73 +440,82 @@ int64_t DateTimeFormat::GetArrayValue(int64_t *dateArray, size_t index, size_t s
     }
 }
 
-std::string DateTimeFormat::Format(int64_t *date, size_t size)
+void DateTimeFormat::InitTimeZone()
 {
-    UErrorCode status = U_ZERO_ERROR;
-    std::string result;
-    UnicodeString dateString;
-    int64_t year = GetArrayValue(date, YEAR_INDEX, size);
-    int64_t month = GetArrayValue(date, MONTH_INDEX, size);
-    int64_t day = GetArrayValue(date, DAY_INDEX, size);
-    int64_t hour = GetArrayValue(date, HOUR_INDEX, size);
-    int64_t minute = GetArrayValue(date, MINUTE_INDEX, size);
-    int64_t second = GetArrayValue(date, SECOND_INDEX, size);
-    calendar->clear();
-    calendar->set(year, month, day, hour, minute, second);
+    if (timeZone.empty() || dateFormat == nullptr) {
+        return;
+    }
+    auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timeZone.c_str()));
+    dateFormat->setTimeZone(*zone);
+    if (dateIntvFormat != nullptr) {
+        dateIntvFormat->setTimeZone(*zone);
+    }
+}
+
+std::unique_ptr<Calendar> DateTimeFormat::CreateCalendar(int64_t *date, size_t size, UErrorCode &status) const
+{
+    // the date is given in the default time zone and converted into the time zone of the formatters.
+    auto dateCalendar = std::unique_ptr<Calendar>(calendar->clone());
+    if (dateCalendar == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    dateCalendar->clear();
+    dateCalendar->set(GetArrayValue(date, YEAR_INDEX, size), GetArrayValue(date, MONTH_INDEX, size),
+        GetArrayValue(date, DAY_INDEX, size), GetArrayValue(date, HOUR_INDEX, size),
+        GetArrayValue(date, MINUTE_INDEX, size), GetArrayValue(date, SECOND_INDEX, size));
     if (!timeZone.empty()) {
-        UDate timestamp = calendar->getTime(status);
-        auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timeZone.c_str()));
-        calendar->setTimeZone(*zone);
-        dateFormat->setTimeZone(*zone);
-        calendar->setTime(timestamp, status);
+        UDate timestamp = dateCalendar->getTime(status);
+        dateCalendar->setTimeZone(dateFormat->getTimeZone());
+        dateCalendar->setTime(timestamp, status);
     }
-    dateFormat->format(calendar->getTime(status), dateString, status);
+    return dateCalendar;
+}
+
+std::string DateTimeFormat::Format(int64_t *date, size_t size) const
+{
+    std::string result;
+    UnicodeString dateString;
+    Format(date, size, dateString);
     dateString.toUTF8String(result);
     return result;
 }
 
-std::string DateTimeFormat::FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate, size_t toDateSize)
+void DateTimeFormat::Format(int64_t *date, size_t size, UnicodeString &dateString) const
 {
     UErrorCode status = U_ZERO_ERROR;
+    dateString.remove();
+    std::unique_ptr<Calendar> dateCalendar = CreateCalendar(date, size, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    dateFormat->format(dateCalendar->getTime(status), dateString, status);
+}
+
+std::string DateTimeFormat::FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate,
+    size_t toDateSize) const
+{
     std::string result;
     UnicodeString dateString;
-    int64_t year = GetArrayValue(fromDate, YEAR_INDEX, fromDateSize);
-    int64_t month = GetArrayValue(fromDate, MONTH_INDEX, fromDateSize);
-    int64_t day = GetArrayValue(fromDate, DAY_INDEX, fromDateSize);
-    int64_t hour = GetArrayValue(fromDate, HOUR_INDEX, fromDateSize);
-    int64_t minute = GetArrayValue(fromDate, MINUTE_INDEX, fromDateSize);
-    int64_t second = GetArrayValue(fromDate, SECOND_INDEX, fromDateSize);
-    calendar->clear();
-    calendar->set(year, month, day, hour, minute, second);
-    if (!timeZone.empty()) {
-        UDate timestamp = calendar->getTime(status);
-        auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timeZone.c_str()));
-        calendar->setTimeZone(*zone);
-        dateIntvFormat->setTimeZone(*zone);
-        calendar->setTime(timestamp, status);
-    }
-    year = GetArrayValue(toDate, YEAR_INDEX, toDateSize);
-    month = GetArrayValue(toDate, MONTH_INDEX, toDateSize);
-    day = GetArrayValue(toDate, DAY_INDEX, toDateSize);
-    hour = GetArrayValue(toDate, HOUR_INDEX, toDateSize);
-    minute = GetArrayValue(toDate, MINUTE_INDEX, toDateSize);
-    second = GetArrayValue(toDate, SECOND_INDEX, toDateSize);
-    auto toCalendar = std::unique_ptr<Calendar>(Calendar::createInstance(locale, status));
-    toCalendar->clear();
-    toCalendar->set(year, month, day, hour, minute, second);
-    if (!timeZone.empty()) {
-        UDate timestamp = toCalendar->getTime(status);
-        auto zone = std::unique_ptr<TimeZone>(TimeZone::createTimeZone(timeZone.c_str()));
-        toCalendar->setTimeZone(*zone);
-        dateIntvFormat->setTimeZone(*zone);
-        toCalendar->setTime(timestamp, status);
-    }
-    FieldPosition pos = 0;
-    dateIntvFormat->format(*calendar, *toCalendar, dateString, pos, status);
+    FormatRange(fromDate, fromDateSize, toDate, toDateSize, dateString);
     dateString.toUTF8String(result);
     return result;
 }
 
+void DateTimeFormat::FormatRange(int64_t *fromDate, size_t fromDateSize, int64_t *toDate, size_t toDateSize,
+    UnicodeString &dateString) const
+{
+    UErrorCode status = U_ZERO_ERROR;
+    dateString.remove();
+    std::unique_ptr<Calendar> fromCalendar = CreateCalendar(fromDate, fromDateSize, status);
+    std::unique_ptr<Calendar> toCalendar = CreateCalendar(toDate, toDateSize, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    FieldPosition pos = 0;
+    dateIntvFormat->format(*fromCalendar, *toCalendar, dateString, pos, status);
+}
+
 void DateTimeFormat::GetResolvedOptions(std::map<std::string, std::string> &map)
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -666,12 +672,6 @@ std::string DateTimeFormat::GetSecond() const
 {
     return second;
 }
-
-bool DateTimeFormat::Init()
-{
-    SetHwIcuDirectory();
-    return true;
-}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
@@ -14,12 +14,14 @@
  */
 
 #include "i18n_break_iterator.h"
+#include "icu_data.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
 I18nBreakIterator::I18nBreakIterator(std::string localeTag)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     iter = icu::BreakIterator::createLineInstance(localeTag.c_str(), status);
 }
@@ -30,12 +30,14 @@
 #include "ustring.h"
 #include "ustr_imp.h"
 #include "hilog/log.h"
+#include "icu_data.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
 I18nCalendar::I18nCalendar(std::string localeTag)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale tempLocale = icu::Locale::forLanguageTag(localeTag, status);
     if (status != U_ZERO_ERROR) {
@@ -47,6 +49,7 @@ I18nCalendar::I18nCalendar(std::string localeTag)
 
 I18nCalendar::I18nCalendar(std::string localeTag, CalendarType type)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale tempLocale = icu::Locale::forLanguageTag(localeTag, status);
     if (status != U_ZERO_ERROR) {
@@ -17,12 +17,14 @@
 #include "unicode/locid.h"
 #include "unicode/unistr.h"
 #include "i18n_timezone.h"
+#include "icu_data.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
 I18nTimeZone::I18nTimeZone(std::string zoneID)
 {
+    InitIcuData();
     if (zoneID.empty()) {
         timezone = icu::TimeZone::createDefault();
     } else {
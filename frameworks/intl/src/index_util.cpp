@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "index_util.h"
+#include "icu_data.h"
 #include "locale_config.h"
 
 namespace OHOS {
@@ -20,6 +21,7 @@ namespace Global {
 namespace I18n {
 IndexUtil::IndexUtil(const std::string &localeTag)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     if (localeTag == "") {
         icu::Locale locale(LocaleConfig::GetSystemLocale().c_str());
@@ -28,22 +30,34 @@ IndexUtil::IndexUtil(const std::string &localeTag)
         icu::Locale locale(localeTag.c_str());
         index = std::make_unique<icu::AlphabeticIndex>(locale, status);
     }
+    BuildImmutableIndex();
 }
 
 IndexUtil::~IndexUtil()
 {
 }
 
-std::vector<std::string> IndexUtil::GetIndexList()
+void IndexUtil::BuildImmutableIndex()
 {
     UErrorCode status = U_ZERO_ERROR;
+    immutableIndex.reset(index->buildImmutableIndex(status));
+    if (U_FAILURE(status)) {
+        immutableIndex = nullptr;
+    }
+}
+
+std::vector<std::string> IndexUtil::GetIndexList() const
+{
     std::vector<std::string> indexList;
-    index->resetBucketIterator(status);
-    while (index->nextBucket(status)) {
-        if (status == U_ZERO_ERROR) {
-            icu::UnicodeString unicodeString = index->getBucketLabel();
+    if (immutableIndex == nullptr) {
+        return indexList;
+    }
+    int32_t bucketCount = immutableIndex->getBucketCount();
+    for (int32_t i = 0; i < bucketCount; i++) {
+        const icu::AlphabeticIndex::Bucket *bucket = immutableIndex->getBucket(i);
+        if (bucket != nullptr) {
             std::string label;
-            unicodeString.toUTF8String(label);
+            bucket->getLabel().toUTF8String(label);
             indexList.push_back(label);
         }
     }
@@ -55,26 +69,26 @@ void IndexUtil::AddLocale(const std::string &localeTag)
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale locale(localeTag.c_str());
     index->addLabels(locale, status);
+    BuildImmutableIndex();
 }
 
-std::string IndexUtil::GetIndex(const std::string &String)
+std::string IndexUtil::GetIndex(const std::string &String) const
 {
+    if (immutableIndex == nullptr) {
+        return "";
+    }
     UErrorCode status = U_ZERO_ERROR;
     icu::UnicodeString unicodeString(String.c_str());
-    int32_t bucketNumber = index->getBucketIndex(unicodeString, status);
+    int32_t bucketNumber = immutableIndex->getBucketIndex(unicodeString, status);
     if (status != U_ZERO_ERROR) {
         return "";
     }
-    index->resetBucketIterator(status);
-    for (int32_t i = 0; i <= bucketNumber; i++) {
-        index->nextBucket(status);
-        if (status != U_ZERO_ERROR) {
-            return "";
-        }
+    const icu::AlphabeticIndex::Bucket *bucket = immutableIndex->getBucket(bucketNumber);
+    if (bucket == nullptr) {
+        return "";
     }
-    icu::UnicodeString label = index->getBucketLabel();
     std::string result;
-    label.toUTF8String(result);
+    bucket->getLabel().toUTF8String(result);
     return result;
 }
 } // namespace I18n
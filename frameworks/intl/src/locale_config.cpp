@@ -12,16 +12,24 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <regex>
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <utility>
 #ifdef TEL_CORE_SERVICE_EXISTS
 #include "core_service_client.h"
 #endif
+#include "icu_data.h"
 #include "libxml/parser.h"
+#include "locale_config_snapshot.h"
+#include "locale_extension.h"
 #include "locale_info.h"
+#include "locale_tables.h"
+#include "lru_cache.h"
 #include "localebuilder.h"
 #include "locid.h"
-#include "ohos/init_data.h"
 #include "parameter.h"
+#include "sorted_table.h"
 #include "securec.h"
 #include "string_ex.h"
 #include "ucase.h"
@@ -37,6 +45,18 @@ namespace Global {
 namespace I18n {
 using namespace std;
 
+// System parameters cached together, valid while generation equals LocaleConfig::paramGeneration.
+struct SystemParams {
+    uint32_t generation;
+    string language;
+    string locale;
+    string region;
+    bool is24Hour;
+    icu::Locale icuLocale;
+    // views into locale.
+    LocaleExtension extension { std::string_view() };
+};
+
 const char *LocaleConfig::LANGUAGE_KEY = "persist.sys.language";
 const char *LocaleConfig::LOCALE_KEY = "persist.sys.locale";
 const char *LocaleConfig::HOUR_KEY = "persist.sys.is24Hour";
@@ -53,37 +73,12 @@ const char *LocaleConfig::FORBIDDEN_REGIONS_PATH = "/system/usr/ohos_locale_conf
 const char *LocaleConfig::SUPPORTED_LOCALES_PATH = "/system/usr/ohos_locale_config/supported_locales.xml";
 const char *LocaleConfig::SUPPORTED_REGIONS_PATH = "/system/usr/ohos_locale_config/supported_regions.xml";
 const char *LocaleConfig::WHITE_LANGUAGES_PATH = "/system/usr/ohos_locale_config/white_languages.xml";
-unordered_set<string> LocaleConfig::supportedLocales;
-unordered_set<string> LocaleConfig::supportedRegions;
-unordered_set<string> LocaleConfig::whiteLanguages;
-unordered_map<string, string> LocaleConfig::dialectMap {
-    { "es-Latn-419", "es-Latn-419" },
-    { "es-Latn-BO", "es-Latn-419" },
-    { "es-Latn-BR", "es-Latn-419" },
-    { "es-Latn-BZ", "es-Latn-419" },
-    { "es-Latn-CL", "es-Latn-419" },
-    { "es-Latn-CO", "es-Latn-419" },
-    { "es-Latn-CR", "es-Latn-419" },
-    { "es-Latn-CU", "es-Latn-419" },
-    { "es-Latn-DO", "es-Latn-419" },
-    { "es-Latn-EC", "es-Latn-419" },
-    { "es-Latn-GT", "es-Latn-419" },
-    { "es-Latn-HN", "es-Latn-419" },
-    { "es-Latn-MX", "es-Latn-419" },
-    { "es-Latn-NI", "es-Latn-419" },
-    { "es-Latn-PA", "es-Latn-419" },
-    { "es-Latn-PE", "es-Latn-419" },
-    { "es-Latn-PR", "es-Latn-419" },
-    { "es-Latn-PY", "es-Latn-419" },
-    { "es-Latn-SV", "es-Latn-419" },
-    { "es-Latn-US", "es-Latn-419" },
-    { "es-Latn-UY", "es-Latn-419" },
-    { "es-Latn-VE", "es-Latn-419" },
-    { "pt-Latn-PT", "pt-Latn-PT" },
-    { "en-Latn-US", "en-Latn-US" }
-};
+const char *LocaleConfig::SNAPSHOT_PATH = "/system/usr/ohos_locale_config/locale_config_snapshot.bin";
+atomic<uint32_t> LocaleConfig::paramGeneration { 0 };
+atomic<bool> LocaleConfig::paramWatched { false };
+shared_ptr<const SystemParams> LocaleConfig::systemParams = nullptr;
 
-set<std::string> LocaleConfig::validCaTag {
+constexpr std::string_view VALID_CA_TAGS[] = {
     "buddhist",
     "chinese",
     "coptic",
@@ -94,17 +89,17 @@ set<std::string> LocaleConfig::validCaTag {
     "hebrew",
     "indian",
     "islamic",
-    "islamic-umalqura",
-    "islamic-tbla",
     "islamic-civil",
     "islamic-rgsa",
+    "islamic-tbla",
+    "islamic-umalqura",
+    "islamicc",
     "iso8601",
     "japanese",
     "persian",
     "roc",
-    "islamicc",
 };
-set<std::string> LocaleConfig::validCoTag {
+constexpr std::string_view VALID_CO_TAGS[] = {
     "big5han",
     "compat",
     "dict",
@@ -122,16 +117,16 @@ set<std::string> LocaleConfig::validCoTag {
     "unihan",
     "zhuyin",
 };
-set<std::string> LocaleConfig::validKnTag {
-    "true",
+constexpr std::string_view VALID_KN_TAGS[] = {
     "false",
+    "true",
 };
-set<std::string> LocaleConfig::validKfTag {
-    "upper",
-    "lower",
+constexpr std::string_view VALID_KF_TAGS[] = {
     "false",
+    "lower",
+    "upper",
 };
-set<std::string> LocaleConfig::validNuTag {
+constexpr std::string_view VALID_NU_TAGS[] = {
     "adlm", "ahom", "arab", "arabext", "bali", "beng",
     "bhks", "brah", "cakm", "cham", "deva", "diak",
     "fullwide", "gong", "gonm", "gujr", "guru", "hanidec",
@@ -144,39 +139,20 @@ set<std::string> LocaleConfig::validNuTag {
     "sora", "sund", "takr", "talu", "tamldec", "telu",
     "thai", "tibt", "tirh", "vaii", "wara", "wcho",
 };
-set<std::string> LocaleConfig::validHcTag {
+constexpr std::string_view VALID_HC_TAGS[] = {
+    "h11",
     "h12",
     "h23",
-    "h11",
     "h24",
 };
-
-static unordered_map<string, string> g_languageMap = {
-    { "zh-Hans", "zh-Hans" },
-    { "zh-Hant", "zh-Hant" },
-    { "my-Qaag", "my-Qaag" },
-    { "es-Latn-419", "es-419" },
-    { "es-Latn-US", "es-419" },
-    { "az-Latn", "az-Latn" },
-    { "bs-Latn", "bs-Latn" },
-    { "en-Qaag", "en-Qaag" },
-    { "uz-Latn", "uz-Latn" },
-    { "sr-Latn", "sr-Latn" },
-    { "jv-Latn", "jv-Latn" },
-    { "pt-Latn-BR", "pt-BR" },
-    { "pa-Guru", "pa-Guru" },
-    { "mai-Deva", "mai-Deva" }
-};
+static_assert(IsSortedTable(VALID_CA_TAGS) && IsSortedTable(VALID_CO_TAGS) && IsSortedTable(VALID_KN_TAGS) &&
+    IsSortedTable(VALID_KF_TAGS) && IsSortedTable(VALID_NU_TAGS) && IsSortedTable(VALID_HC_TAGS),
+    "extension value tables must be sorted");
 
 string Adjust(const string &origin)
 {
-    for (auto iter = g_languageMap.begin(); iter != g_languageMap.end(); ++iter) {
-        string key = iter->first;
-        if (!origin.compare(0, key.length(), key)) {
-            return iter->second;
-        }
-    }
-    return origin;
+    std::string_view adjust = TableFindPrefix(LANGUAGE_MAP, origin);
+    return adjust.empty() ? origin : string(adjust);
 }
 
 int32_t GetDialectName(const char *localeName, char *name, size_t nameCapacity, UErrorCode &status)
@@ -287,57 +263,96 @@ string GetDisplayLanguageInner(const string &language, const string &displayLoca
     return out;
 }
 
-bool LocaleConfig::listsInitialized = LocaleConfig::InitializeLists();
-
 string LocaleConfig::GetSystemLanguage()
 {
-    char value[CONFIG_LEN];
-    int code = GetParameter(LANGUAGE_KEY, "", value, CONFIG_LEN);
-    if (code > 0) {
-        return value;
-    }
-    code = GetParameter(DEFAULT_LANGUAGE_KEY, "", value, CONFIG_LEN);
-    if (code > 0) {
-        return value;
-    }
-    return "";
+    return GetSystemParams()->language;
 }
 
 string LocaleConfig::GetSystemRegion()
 {
-    string locale = GetSystemLocale();
-    char value[CONFIG_LEN];
-    int code = GetParameter(LOCALE_KEY, "", value, CONFIG_LEN);
-    if (code > 0) {
-        string tag(value, code);
-        UErrorCode status = U_ZERO_ERROR;
-        icu::Locale origin = icu::Locale::forLanguageTag(tag, status);
-        if (status == U_ZERO_ERROR) {
-            const char *country = origin.getCountry();
-            if (country != nullptr) {
-                return country;
-            }
-        }
-    }
-    code = GetParameter(DEFAULT_REGION_KEY, "", value, CONFIG_LEN);
-    if (code > 0) {
-        return value;
-    }
-    return "";
+    return GetSystemParams()->region;
 }
 
 string LocaleConfig::GetSystemLocale()
 {
+    return GetSystemParams()->locale;
+}
+
+icu::Locale LocaleConfig::GetSystemIcuLocale()
+{
+    return GetSystemParams()->icuLocale;
+}
+
+shared_ptr<const SystemParams> LocaleConfig::GetSystemParams()
+{
+    static once_flag watchFlag;
+    call_once(watchFlag, WatchSystemParams);
+    // the generation is read before the parameters, so a change racing with the reload forces another one.
+    uint32_t generation = paramGeneration.load(memory_order_acquire);
+    shared_ptr<const SystemParams> params = atomic_load_explicit(&systemParams, memory_order_acquire);
+    if (params != nullptr && params->generation == generation && paramWatched.load(memory_order_relaxed)) {
+        return params;
+    }
+    params = LoadSystemParams(generation);
+    atomic_store_explicit(&systemParams, params, memory_order_release);
+    return params;
+}
+
+shared_ptr<const SystemParams> LocaleConfig::LoadSystemParams(uint32_t generation)
+{
+    shared_ptr<SystemParams> params = make_shared<SystemParams>();
+    params->generation = generation;
     char value[CONFIG_LEN];
-    int code = GetParameter(LOCALE_KEY, "", value, CONFIG_LEN);
+    int code = GetParameter(LANGUAGE_KEY, "", value, CONFIG_LEN);
+    if (code <= 0) {
+        code = GetParameter(DEFAULT_LANGUAGE_KEY, "", value, CONFIG_LEN);
+    }
     if (code > 0) {
-        return value;
+        params->language = value;
     }
-    code = GetParameter(DEFAULT_LOCALE_KEY, "", value, CONFIG_LEN);
+    bool hasLocale = true;
+    code = GetParameter(LOCALE_KEY, "", value, CONFIG_LEN);
+    if (code <= 0) {
+        hasLocale = false;
+        code = GetParameter(DEFAULT_LOCALE_KEY, "", value, CONFIG_LEN);
+    }
+    UErrorCode status = U_ZERO_ERROR;
     if (code > 0) {
-        return value;
+        params->locale = value;
+        params->icuLocale = icu::Locale::forLanguageTag(params->locale, status);
+        params->extension = LocaleExtension(params->locale);
     }
-    return "";
+    // the region only follows persist.sys.locale, otherwise it comes from const.sys.region.
+    if (hasLocale && status == U_ZERO_ERROR) {
+        params->region = params->icuLocale.getCountry();
+    } else {
+        code = GetParameter(DEFAULT_REGION_KEY, "", value, CONFIG_LEN);
+        if (code > 0) {
+            params->region = value;
+        }
+    }
+    code = GetParameter(HOUR_KEY, "", value, CONFIG_LEN);
+    params->is24Hour = (code > 0) && !strcmp(value, "true");
+    return params;
+}
+
+void LocaleConfig::WatchSystemParams()
+{
+    // without a watch on every key the cached parameters could go stale, so they are re-read on each call.
+    bool watched = WatchParameter(LANGUAGE_KEY, OnParameterChanged, nullptr) == 0;
+    watched = (WatchParameter(LOCALE_KEY, OnParameterChanged, nullptr) == 0) && watched;
+    watched = (WatchParameter(HOUR_KEY, OnParameterChanged, nullptr) == 0) && watched;
+    paramWatched.store(watched, memory_order_release);
+}
+
+void LocaleConfig::OnParameterChanged(const char *key, const char *value, void *context)
+{
+    InvalidateSystemParams();
+}
+
+void LocaleConfig::InvalidateSystemParams()
+{
+    paramGeneration.fetch_add(1, memory_order_acq_rel);
 }
 
 bool LocaleConfig::SetSystemLanguage(const string &language)
@@ -345,7 +360,9 @@ bool LocaleConfig::SetSystemLanguage(const string &language)
     if (!IsValidTag(language)) {
         return false;
     }
-    return SetParameter(LANGUAGE_KEY, language.data()) == 0;
+    bool ret = SetParameter(LANGUAGE_KEY, language.data()) == 0;
+    InvalidateSystemParams();
+    return ret;
 }
 
 bool LocaleConfig::SetSystemRegion(const string &region)
@@ -374,7 +391,9 @@ bool LocaleConfig::SetSystemRegion(const string &region)
             return false;
         }
     }
-    return SetParameter(LOCALE_KEY, newLocale.data()) == 0;
+    bool ret = SetParameter(LOCALE_KEY, newLocale.data()) == 0;
+    InvalidateSystemParams();
+    return ret;
 }
 
 bool LocaleConfig::SetSystemLocale(const string &locale)
@@ -382,7 +401,9 @@ bool LocaleConfig::SetSystemLocale(const string &locale)
     if (!IsValidTag(locale)) {
         return false;
     }
-    return SetParameter(LOCALE_KEY, locale.data()) == 0;
+    bool ret = SetParameter(LOCALE_KEY, locale.data()) == 0;
+    InvalidateSystemParams();
+    return ret;
 }
 
 bool LocaleConfig::IsValidLanguage(const string &language)
@@ -461,89 +482,124 @@ void LocaleConfig::Split(const string &src, const string &sep, vector<string> &d
 // language in white languages should have script.
 void LocaleConfig::GetSystemLanguages(vector<string> &ret)
 {
-    for (auto item : whiteLanguages) {
-        ret.push_back(item);
+    const LocaleConfigSnapshot &lists = GetLocaleLists();
+    for (uint32_t i = 0; i < lists.Size(WHITE_LANGUAGES); ++i) {
+        ret.emplace_back(lists.At(WHITE_LANGUAGES, i));
     }
 }
 
-const unordered_set<string>& LocaleConfig::GetSupportedLocales()
+const LocaleConfigSnapshot &LocaleConfig::GetLocaleLists()
 {
-    return supportedLocales;
+    static LocaleConfigSnapshot lists;
+    static std::once_flag listsFlag;
+    std::call_once(listsFlag, InitializeLists, std::ref(lists));
+    return lists;
 }
 
-const unordered_set<string>& LocaleConfig::GetSupportedRegions()
+void LocaleConfig::GetSystemCountries(vector<string> &ret)
 {
-    return supportedRegions;
+    const LocaleConfigSnapshot &lists = GetLocaleLists();
+    for (uint32_t i = 0; i < lists.Size(SUPPORTED_REGIONS); ++i) {
+        ret.emplace_back(lists.At(SUPPORTED_REGIONS, i));
+    }
 }
 
-void LocaleConfig::GetSystemCountries(vector<string> &ret)
+using MainLanguageCache = LruCache<string, string>;
+const size_t MAIN_LANGUAGE_CACHE_SIZE = 128;
+
+MainLanguageCache &GetMainLanguageCache()
 {
-    for (auto item : supportedRegions) {
-        ret.push_back(item);
+    static MainLanguageCache cache(MAIN_LANGUAGE_CACHE_SIZE);
+    return cache;
+}
+
+// suggestion queries repeat the same few tags, so their main languages are kept instead of recomputed.
+string LocaleConfig::GetCachedMainLanguage(const string &language)
+{
+    string mainLanguage;
+    if (GetMainLanguageCache().Get(language, mainLanguage)) {
+        return mainLanguage;
     }
+    mainLanguage = GetMainLanguage(language);
+    GetMainLanguageCache().Put(language, mainLanguage);
+    return mainLanguage;
 }
 
 bool LocaleConfig::IsSuggested(const string &language)
 {
-    unordered_set<string> relatedLocales;
     vector<string> simCountries;
     GetCountriesFromSim(simCountries);
-    GetRelatedLocales(relatedLocales, simCountries);
-    for (auto iter = relatedLocales.begin(); iter != relatedLocales.end();) {
-        if (whiteLanguages.find(*iter) == whiteLanguages.end()) {
-            iter = relatedLocales.erase(iter);
-        } else {
-            ++iter;
-        }
-    }
-    string mainLanguage = GetMainLanguage(language);
-    return relatedLocales.find(mainLanguage) != relatedLocales.end();
+    return IsSuggestedInRegions(GetCachedMainLanguage(language), simCountries);
 }
 
 bool LocaleConfig::IsSuggested(const std::string &language, const std::string &region)
 {
-    unordered_set<string> relatedLocales;
     vector<string> countries { region };
-    GetRelatedLocales(relatedLocales, countries);
-    for (auto iter = relatedLocales.begin(); iter != relatedLocales.end();) {
-        if (whiteLanguages.find(*iter) == whiteLanguages.end()) {
-            iter = relatedLocales.erase(iter);
-        } else {
-            ++iter;
-        }
+    return IsSuggestedInRegions(GetCachedMainLanguage(language), countries);
+}
+
+void LocaleConfig::IsSuggested(const vector<string> &languages, vector<bool> &ret)
+{
+    vector<string> simCountries;
+    GetCountriesFromSim(simCountries);
+    ret.reserve(ret.size() + languages.size());
+    for (const string &language : languages) {
+        ret.push_back(IsSuggestedInRegions(GetCachedMainLanguage(language), simCountries));
     }
-    string mainLanguage = GetMainLanguage(language);
-    return relatedLocales.find(mainLanguage) != relatedLocales.end();
 }
 
-void LocaleConfig::GetRelatedLocales(unordered_set<string> &relatedLocales, vector<string> countries)
+void LocaleConfig::IsSuggested(const vector<string> &languages, const string &region, vector<bool> &ret)
 {
-    // remove unsupported countries
-    const unordered_set<string> &regions = GetSupportedRegions();
-    for (auto iter = countries.begin(); iter != countries.end();) {
-        if (regions.find(*iter) == regions.end()) {
-            iter = countries.erase(iter);
-        } else {
-            ++iter;
+    vector<string> countries { region };
+    ret.reserve(ret.size() + languages.size());
+    for (const string &language : languages) {
+        ret.push_back(IsSuggestedInRegions(GetCachedMainLanguage(language), countries));
+    }
+}
+
+bool LocaleConfig::IsSuggestedInRegions(const string &mainLanguage, const vector<string> &regions)
+{
+    if (mainLanguage.empty()) {
+        return false;
+    }
+    const unordered_map<string, unordered_set<string>> &suggestedLanguages = GetSuggestedLanguages();
+    for (const string &region : regions) {
+        auto iter = suggestedLanguages.find(region);
+        if (iter != suggestedLanguages.end() && iter->second.count(mainLanguage) > 0) {
+            return true;
         }
     }
-    const unordered_set<string> &locales = GetSupportedLocales();
-    for (string locale : locales) {
-        bool find = false;
-        for (string country : countries) {
-            if (locale.find(country) != string::npos) {
-                find = true;
-                break;
-            }
+    return false;
+}
+
+const unordered_map<string, unordered_set<string>> &LocaleConfig::GetSuggestedLanguages()
+{
+    static const unordered_map<string, unordered_set<string>> suggestedLanguages = InitSuggestedLanguages();
+    return suggestedLanguages;
+}
+
+unordered_map<string, unordered_set<string>> LocaleConfig::InitSuggestedLanguages()
+{
+    // maps each supported region to the white listed main languages of the supported locales in that region.
+    const LocaleConfigSnapshot &lists = GetLocaleLists();
+    unordered_map<string, unordered_set<string>> suggestedLanguages;
+    for (uint32_t i = 0; i < lists.Size(SUPPORTED_LOCALES); ++i) {
+        string locale(lists.At(SUPPORTED_LOCALES, i));
+        UErrorCode status = U_ZERO_ERROR;
+        icu::Locale origin = icu::Locale::forLanguageTag(locale, status);
+        if (status != U_ZERO_ERROR) {
+            continue;
         }
-        if (!find) {
+        string region = origin.getCountry();
+        if (region.empty() || !lists.Contains(SUPPORTED_REGIONS, region)) {
             continue;
         }
         string mainLanguage = GetMainLanguage(locale);
-        if (mainLanguage != "") {
-            relatedLocales.insert(mainLanguage);
+        if (mainLanguage != "" && lists.Contains(WHITE_LANGUAGES, mainLanguage)) {
+            suggestedLanguages[region].insert(mainLanguage);
         }
     }
+    return suggestedLanguages;
 }
 
 void LocaleConfig::GetCountriesFromSim(vector<string> &simCountries)
@@ -596,19 +652,38 @@ void LocaleConfig::Expunge(unordered_set<string> &src, const unordered_set<strin
     }
 }
 
-bool LocaleConfig::InitializeLists()
+void LocaleConfig::InitializeLists(LocaleConfigSnapshot &lists)
 {
-    SetHwIcuDirectory();
+    InitIcuData();
+    // the order must match SOURCE_ORDER in tools/locale_config_snapshot.py
+    const char *sources[] = {
+        SUPPORTED_REGIONS_PATH,
+        FORBIDDEN_REGIONS_PATH,
+        WHITE_LANGUAGES_PATH,
+        FORBIDDEN_LANGUAGES_PATH,
+        SUPPORTED_LOCALES_PATH
+    };
+    if (lists.Load(SNAPSHOT_PATH, sources, sizeof(sources) / sizeof(sources[0]))) {
+        return;
+    }
+    unordered_set<string> supportedRegions;
     GetListFromFile(SUPPORTED_REGIONS_PATH, SUPPORTED_REGIONS_NAME, supportedRegions);
     unordered_set<string> forbiddenRegions;
     GetListFromFile(FORBIDDEN_REGIONS_PATH, FORBIDDEN_REGIONS_NAME, forbiddenRegions);
     Expunge(supportedRegions, forbiddenRegions);
+    unordered_set<string> whiteLanguages;
     GetListFromFile(WHITE_LANGUAGES_PATH, WHITE_LANGUAGES_NAME, whiteLanguages);
     unordered_set<string> forbiddenLanguages;
     GetListFromFile(FORBIDDEN_LANGUAGES_PATH, FORBIDDEN_LANGUAGES_NAME, forbiddenLanguages);
     Expunge(whiteLanguages, forbiddenLanguages);
+    unordered_set<string> supportedLocales;
     GetListFromFile(SUPPORTED_LOCALES_PATH, SUPPORTED_LOCALES_NAME, supportedLocales);
-    return true;
+    vector<string> regionList(supportedRegions.begin(), supportedRegions.end());
+    lists.Assign(SUPPORTED_REGIONS, regionList);
+    vector<string> languageList(whiteLanguages.begin(), whiteLanguages.end());
+    lists.Assign(WHITE_LANGUAGES, languageList);
+    vector<string> localeList(supportedLocales.begin(), supportedLocales.end());
+    lists.Assign(SUPPORTED_LOCALES, localeList);
 }
 
 string LocaleConfig::GetRegionChangeLocale(const string &languageTag, const string &region)
@@ -630,6 +705,7 @@ string LocaleConfig::GetRegionChangeLocale(const string &languageTag, const stri
 
 string LocaleConfig::GetMainLanguage(const string &language)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale origin = icu::Locale::forLanguageTag(language, status);
     if (status != U_ZERO_ERROR) {
@@ -646,8 +722,9 @@ string LocaleConfig::GetMainLanguage(const string &language)
     if (status != U_ZERO_ERROR) {
         return "";
     }
-    if (dialectMap.find(fullLanguage) != dialectMap.end()) {
-        return dialectMap[fullLanguage];
+    std::string_view dialect = TableFind(DIALECT_MAP, fullLanguage);
+    if (!dialect.empty()) {
+        return string(dialect);
     }
     builder.setRegion("");
     temp = builder.build(status);
@@ -658,8 +735,92 @@ string LocaleConfig::GetMainLanguage(const string &language)
     return fullLanguage;
 }
 
+struct DisplayNameKey {
+    string code;
+    string displayLocale;
+    bool sentenceCase;
+
+    bool operator==(const DisplayNameKey &other) const
+    {
+        return sentenceCase == other.sentenceCase && code == other.code && displayLocale == other.displayLocale;
+    }
+};
+
+struct DisplayNameKeyHash {
+    size_t operator()(const DisplayNameKey &key) const
+    {
+        size_t seed = hash<string>()(key.code);
+        seed ^= hash<string>()(key.displayLocale) + 0x9e3779b9 + (seed << 6) + (seed >> 2); // 6, 2: hash mixing
+        return (seed << 1) | (key.sentenceCase ? 1 : 0);
+    }
+};
+
+using DisplayNameCache = LruCache<DisplayNameKey, string, DisplayNameKeyHash>;
+const size_t DISPLAY_NAME_CACHE_SIZE = 512;
+
+DisplayNameCache &GetDisplayLanguageCache()
+{
+    static DisplayNameCache cache(DISPLAY_NAME_CACHE_SIZE);
+    return cache;
+}
+
+DisplayNameCache &GetDisplayRegionCache()
+{
+    static DisplayNameCache cache(DISPLAY_NAME_CACHE_SIZE);
+    return cache;
+}
+
 string LocaleConfig::GetDisplayLanguage(const string &language, const string &displayLocale, bool sentenceCase)
 {
+    DisplayNameKey key = { language, displayLocale, sentenceCase };
+    string result;
+    if (GetDisplayLanguageCache().Get(key, result)) {
+        return result;
+    }
+    result = ComputeDisplayLanguage(language, displayLocale, sentenceCase);
+    GetDisplayLanguageCache().Put(key, result);
+    return result;
+}
+
+string LocaleConfig::GetDisplayRegion(const string &region, const string &displayLocale, bool sentenceCase)
+{
+    DisplayNameKey key = { region, displayLocale, sentenceCase };
+    string result;
+    if (GetDisplayRegionCache().Get(key, result)) {
+        return result;
+    }
+    result = ComputeDisplayRegion(region, displayLocale, sentenceCase);
+    GetDisplayRegionCache().Put(key, result);
+    return result;
+}
+
+void LocaleConfig::GetDisplayLanguages(const vector<string> &languages, const string &displayLocale,
+    bool sentenceCase, vector<string> &ret)
+{
+    ret.reserve(ret.size() + languages.size());
+    for (const string &language : languages) {
+        ret.push_back(GetDisplayLanguage(language, displayLocale, sentenceCase));
+    }
+}
+
+void LocaleConfig::GetDisplayRegions(const vector<string> &regions, const string &displayLocale,
+    bool sentenceCase, vector<string> &ret)
+{
+    ret.reserve(ret.size() + regions.size());
+    for (const string &region : regions) {
+        ret.push_back(GetDisplayRegion(region, displayLocale, sentenceCase));
+    }
+}
+
+void LocaleConfig::GetDisplayNameCacheStats(uint64_t &hits, uint64_t &misses)
+{
+    hits = GetDisplayLanguageCache().GetHits() + GetDisplayRegionCache().GetHits();
+    misses = GetDisplayLanguageCache().GetMisses() + GetDisplayRegionCache().GetMisses();
+}
+
+string LocaleConfig::ComputeDisplayLanguage(const string &language, const string &displayLocale, bool sentenceCase)
+{
+    InitIcuData();
     string adjust = Adjust(language);
     if (adjust == language) {
         UErrorCode status = U_ZERO_ERROR;
@@ -684,8 +845,9 @@ string LocaleConfig::GetDisplayLanguage(const string &language, const string &di
     return GetDisplayLanguageInner(adjust, displayLocale, sentenceCase);
 }
 
-string LocaleConfig::GetDisplayRegion(const string &region, const string &displayLocale, bool sentenceCase)
+string LocaleConfig::ComputeDisplayRegion(const string &region, const string &displayLocale, bool sentenceCase)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     icu::Locale originLocale;
     if (IsValidRegion(region)) {
@@ -715,6 +877,7 @@ string LocaleConfig::GetDisplayRegion(const string &region, const string &displa
 
 bool LocaleConfig::IsRTL(const string &locale)
 {
+    InitIcuData();
     icu::Locale curLocale(locale.c_str());
     return curLocale.isRightToLeft();
 }
@@ -738,110 +901,79 @@ std::string ContainTag(std::string &localeTag, std::string &defaultLocaleTag,
     return tag.substr(start, end - start);
 }
 
-void parseExtension(const std::string &extension, std::map<std::string, std::string> &map)
+template<size_t N>
+void SetExtension(std::string &extension, std::string_view key, const std::string_view (&validValues)[N],
+    const LocaleExtension &localeExtension, const LocaleExtension &defaultExtension)
 {
-    std::string pattern = "-..-";
-    std::regex express(pattern);
-
-    std::regex_token_iterator<std::string::const_iterator> begin1(extension.cbegin(), extension.cend(), express);
-    std::regex_token_iterator<std::string::const_iterator> begin2(extension.cbegin(), extension.cend(), express, -1);
-    begin2++;
-    for (; begin1 != std::sregex_token_iterator() && begin2 != std::sregex_token_iterator(); begin1++, begin2++) {
-        map.insert(std::pair<std::string, std::string>(begin1->str(), begin2->str()));
+    std::string_view value = localeExtension.Find(key);
+    if (value.empty()) {
+        value = defaultExtension.Find(key);
+    }
+    if (value.empty() || !TableContains(validValues, value)) {
+        return;
     }
+    extension.append("-").append(key).append("-").append(value);
 }
 
-void setExtension(std::string &extension, const std::string &tag, const std::set<string> &validValue,
-    const std::map<std::string, std::string> &extensionMap,
-    const std::map<std::string, std::string> &defaultExtensionMap)
+bool IsKnownExtensionKey(std::string_view key)
 {
-    std::string value = "";
-    auto it = extensionMap.find(tag);
-    if (it != extensionMap.end()) {
-        value = it->second;
-        if (validValue.find(value) == validValue.end()) {
-            return;
-        } else {
-            extension += tag;
-            extension += value;
-        }
-    } else {
-        it = defaultExtensionMap.find(tag);
-        if (it != defaultExtensionMap.end()) {
-            value = it->second;
-            if (validValue.find(value) == validValue.end()) {
-                return;
-            } else {
-                extension += tag;
-                extension += value;
-            }
-        }
-    }
+    return key == "ca" || key == "co" || key == "kn" || key == "kf" || key == "nu" || key == "hc";
 }
 
-void setOtherExtension(std::string &extension, std::map<std::string, std::string> &extensionMap,
-    std::map<std::string, std::string> &defaultExtensionMap)
+bool CompareExtensionKey(const std::pair<std::string_view, std::string_view> &left,
+    const std::pair<std::string_view, std::string_view> &right)
 {
-    std::set<std::string> tags;
-    tags.insert("-ca-");
-    tags.insert("-co-");
-    tags.insert("-kn-");
-    tags.insert("-kf-");
-    tags.insert("-nu-");
-    tags.insert("-hc-");
-
-    for (auto it = tags.begin(); it != tags.end(); it++) {
-        extensionMap.erase(*it);
-        defaultExtensionMap.erase(*it);
-    }
+    return left.first < right.first;
+}
 
-    for (auto it = defaultExtensionMap.begin(); it != defaultExtensionMap.end(); it++) {
-        extensionMap.insert(std::pair<std::string, std::string>(it->first, it->second));
+void SetOtherExtension(std::string &extension, const LocaleExtension &localeExtension,
+    const LocaleExtension &defaultExtension)
+{
+    // keywords of the tag take precedence over those of the system locale, and are emitted sorted by key.
+    std::pair<std::string_view, std::string_view> others[LocaleExtension::MAX_KEYWORDS * 2];
+    size_t count = 0;
+    for (const LocaleExtension *source : { &localeExtension, &defaultExtension }) {
+        for (size_t i = 0; i < source->Size(); ++i) {
+            std::string_view key = source->Key(i);
+            if (IsKnownExtensionKey(key)) {
+                continue;
+            }
+            bool duplicated = false;
+            for (size_t j = 0; j < count; ++j) {
+                duplicated = duplicated || (others[j].first == key);
+            }
+            if (!duplicated) {
+                others[count++] = { key, source->Value(i) };
+            }
+        }
     }
-
-    for (auto it = extensionMap.begin(); it != extensionMap.end(); it++) {
-        extension += it->first;
-        extension += it->second;
+    std::sort(others, others + count, CompareExtensionKey);
+    for (size_t i = 0; i < count; ++i) {
+        extension.append("-").append(others[i].first);
+        if (!others[i].second.empty()) {
+            extension.append("-").append(others[i].second);
+        }
     }
 }
 
 std::string LocaleConfig::GetValidLocale(const std::string &localeTag)
 {
-    std::string baseLocale = "";
-    std::string extension = "";
-    std::size_t found = localeTag.find("-u-");
-    baseLocale = localeTag.substr(0, found);
-    if (found != std::string::npos) {
-        extension = localeTag.substr(found);
-    }
-    std::map<std::string, std::string> extensionMap;
-    if (extension != "") {
-        parseExtension(extension, extensionMap);
-    }
-
-    std::string systemLocaleTag = GetSystemLocale();
-    std::string defaultExtension = "";
-    found = systemLocaleTag.find("-u-");
-    if (found != std::string::npos) {
-        defaultExtension = systemLocaleTag.substr(found);
-    }
-    std::map<std::string, std::string> defaultExtensionMap;
-    if (defaultExtension != "") {
-        parseExtension(defaultExtension, defaultExtensionMap);
-    }
-
+    // the extension of the system locale is tokenized once per snapshot of the parameters.
+    std::shared_ptr<const SystemParams> params = GetSystemParams();
+    LocaleExtension localeExtension(localeTag);
+    const LocaleExtension &defaultExtension = params->extension;
     std::string ext = "";
-    setExtension(ext, "-ca-", validCaTag, extensionMap, defaultExtensionMap);
-    setExtension(ext, "-co-", validCoTag, extensionMap, defaultExtensionMap);
-    setExtension(ext, "-kn-", validKnTag, extensionMap, defaultExtensionMap);
-    setExtension(ext, "-kf-", validKfTag, extensionMap, defaultExtensionMap);
-    setExtension(ext, "-nu-", validNuTag, extensionMap, defaultExtensionMap);
-    setExtension(ext, "-hc-", validHcTag, extensionMap, defaultExtensionMap);
-
-    std::string otherExt = "";
-    setOtherExtension(otherExt, extensionMap, defaultExtensionMap);
-    if (ext != "" || otherExt != "") {
-        return baseLocale + "-u" + ext + otherExt;
+    SetExtension(ext, "ca", VALID_CA_TAGS, localeExtension, defaultExtension);
+    SetExtension(ext, "co", VALID_CO_TAGS, localeExtension, defaultExtension);
+    SetExtension(ext, "kn", VALID_KN_TAGS, localeExtension, defaultExtension);
+    SetExtension(ext, "kf", VALID_KF_TAGS, localeExtension, defaultExtension);
+    SetExtension(ext, "nu", VALID_NU_TAGS, localeExtension, defaultExtension);
+    SetExtension(ext, "hc", VALID_HC_TAGS, localeExtension, defaultExtension);
+    SetOtherExtension(ext, localeExtension, defaultExtension);
+
+    std::string baseLocale(LocaleExtension::GetBaseName(localeTag));
+    if (ext != "") {
+        return baseLocale + "-u" + ext;
     } else {
         return baseLocale;
     }
@@ -849,15 +981,7 @@ std::string LocaleConfig::GetValidLocale(const std::string &localeTag)
 
 bool LocaleConfig::Is24HourClock()
 {
-    char value[CONFIG_LEN];
-    int code = GetParameter(HOUR_KEY, "", value, CONFIG_LEN);
-    if (code <= 0) {
-        return false;
-    }
-    if (!strcmp(value, "true")) {
-        return true;
-    }
-    return false;
+    return GetSystemParams()->is24Hour;
 }
 
 bool LocaleConfig::Set24HourClock(bool option)
@@ -868,7 +992,9 @@ bool LocaleConfig::Set24HourClock(bool option)
     } else {
         optionStr = "false";
     }
-    return SetParameter(HOUR_KEY, optionStr.data()) == 0;
+    bool ret = SetParameter(HOUR_KEY, optionStr.data()) == 0;
+    InvalidateSystemParams();
+    return ret;
 }
 } // namespace I18n
 } // namespace Global
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "locale_config_snapshot.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+LocaleConfigSnapshot::~LocaleConfigSnapshot()
+{
+    Unmap();
+}
+
+bool LocaleConfigSnapshot::Load(const char *path, const char * const *sources, uint32_t sourceCount)
+{
+    Unmap();
+    if (!path) {
+        return false;
+    }
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return false;
+    }
+    void *addr = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    mapped = addr;
+    mappedSize = static_cast<size_t>(fileStat.st_size);
+    if (!Validate(sources, sourceCount)) {
+        Unmap();
+        return false;
+    }
+    return true;
+}
+
+bool LocaleConfigSnapshot::Validate(const char * const *sources, uint32_t sourceCount)
+{
+    const char *base = static_cast<const char *>(mapped);
+    const Header *header = reinterpret_cast<const Header *>(base);
+    if (memcmp(header->magic, "LCS1", sizeof(header->magic)) || header->version != SNAPSHOT_VERSION ||
+        header->sourceCount != sourceCount || header->listCount != LOCALE_LIST_COUNT) {
+        return false;
+    }
+    if (header->poolOffset > mappedSize || header->poolSize > mappedSize - header->poolOffset) {
+        return false;
+    }
+    size_t listsOffset = sizeof(Header) + sizeof(SourceEntry) * sourceCount;
+    if (listsOffset + sizeof(ListEntry) * LOCALE_LIST_COUNT > header->poolOffset) {
+        return false;
+    }
+    // the snapshot is stale when the content of any of the xml files it was compiled from has changed.
+    const SourceEntry *sourceEntries = reinterpret_cast<const SourceEntry *>(base + sizeof(Header));
+    for (uint32_t i = 0; i < sourceCount; ++i) {
+        if (!IsSourceUnchanged(sources[i], sourceEntries[i])) {
+            return false;
+        }
+    }
+    const ListEntry *entries = reinterpret_cast<const ListEntry *>(base + listsOffset);
+    for (uint32_t i = 0; i < LOCALE_LIST_COUNT; ++i) {
+        if (entries[i].tableOffset > header->poolOffset ||
+            entries[i].count > (header->poolOffset - entries[i].tableOffset) / sizeof(ItemEntry)) {
+            return false;
+        }
+        const ItemEntry *items = reinterpret_cast<const ItemEntry *>(base + entries[i].tableOffset);
+        for (uint32_t j = 0; j < entries[i].count; ++j) {
+            if (items[j].offset > header->poolSize || items[j].length > header->poolSize - items[j].offset) {
+                return false;
+            }
+        }
+    }
+    for (uint32_t i = 0; i < LOCALE_LIST_COUNT; ++i) {
+        tables[i] = reinterpret_cast<const ItemEntry *>(base + entries[i].tableOffset);
+        counts[i] = entries[i].count;
+    }
+    pool = base + header->poolOffset;
+    return true;
+}
+
+bool LocaleConfigSnapshot::IsSourceUnchanged(const char *path, const SourceEntry &source)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat sourceStat;
+    if (fstat(fd, &sourceStat) != 0 || static_cast<uint64_t>(sourceStat.st_size) != source.size) {
+        close(fd);
+        return false;
+    }
+    // the files are small, they are hashed through a stack buffer without any allocation.
+    unsigned char buffer[HASH_BUFFER_SIZE];
+    uint64_t hash = FNV_OFFSET_BASIS;
+    uint64_t total = 0;
+    ssize_t length = 0;
+    while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t i = 0; i < length; ++i) {
+            hash = (hash ^ buffer[i]) * FNV_PRIME;
+        }
+        total += static_cast<uint64_t>(length);
+    }
+    close(fd);
+    return length == 0 && total == source.size && hash == source.hash;
+}
+
+void LocaleConfigSnapshot::Unmap()
+{
+    if (mapped != nullptr) {
+        munmap(mapped, mappedSize);
+        mapped = nullptr;
+        mappedSize = 0;
+    }
+    for (uint32_t i = 0; i < LOCALE_LIST_COUNT; ++i) {
+        tables[i] = nullptr;
+        counts[i] = 0;
+    }
+    pool = nullptr;
+}
+
+void LocaleConfigSnapshot::Assign(LocaleListType type, std::vector<std::string> &items)
+{
+    std::sort(items.begin(), items.end());
+    lists[type].swap(items);
+    counts[type] = static_cast<uint32_t>(lists[type].size());
+}
+
+uint32_t LocaleConfigSnapshot::Size(LocaleListType type) const
+{
+    return counts[type];
+}
+
+std::string_view LocaleConfigSnapshot::At(LocaleListType type, uint32_t index) const
+{
+    if (tables[type] != nullptr) {
+        return std::string_view(pool + tables[type][index].offset, tables[type][index].length);
+    }
+    return lists[type][index];
+}
+
+bool LocaleConfigSnapshot::Contains(LocaleListType type, std::string_view item) const
+{
+    uint32_t low = 0;
+    uint32_t high = counts[type];
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        int cmp = At(type, mid).compare(item);
+        if (!cmp) {
+            return true;
+        } else if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return false;
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
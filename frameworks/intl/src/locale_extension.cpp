@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "locale_extension.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+constexpr std::string_view EXTENSION_SEPARATOR = "-u-";
+
+LocaleExtension::LocaleExtension(std::string_view localeTag)
+{
+    size_t found = localeTag.find(EXTENSION_SEPARATOR);
+    if (found == std::string_view::npos) {
+        return;
+    }
+    // subtags before the first key are attributes, they are skipped.
+    size_t pos = found + EXTENSION_SEPARATOR.size();
+    Keyword *current = nullptr;
+    while (pos <= localeTag.size()) {
+        size_t end = localeTag.find('-', pos);
+        if (end == std::string_view::npos) {
+            end = localeTag.size();
+        }
+        size_t length = end - pos;
+        if (length == 1) {
+            // another singleton, such as -x- for private use, ends the extension.
+            break;
+        }
+        if (length == KEY_LEN) {
+            current = (count < MAX_KEYWORDS) ? &keywords[count++] : nullptr;
+            if (current != nullptr) {
+                current->key = localeTag.substr(pos, length);
+                current->value = std::string_view();
+            }
+        } else if (length > 0 && current != nullptr) {
+            if (current->value.empty()) {
+                current->value = localeTag.substr(pos, length);
+            } else {
+                size_t start = current->value.data() - localeTag.data();
+                current->value = localeTag.substr(start, end - start);
+            }
+        }
+        pos = end + 1;
+    }
+}
+
+std::string_view LocaleExtension::Find(std::string_view key) const
+{
+    for (size_t i = 0; i < count; ++i) {
+        if (keywords[i].key == key) {
+            return keywords[i].value;
+        }
+    }
+    return std::string_view();
+}
+
+size_t LocaleExtension::Size() const
+{
+    return count;
+}
+
+std::string_view LocaleExtension::Key(size_t index) const
+{
+    return keywords[index].key;
+}
+
+std::string_view LocaleExtension::Value(size_t index) const
+{
+    return keywords[index].value;
+}
+
+std::string_view LocaleExtension::GetBaseName(std::string_view localeTag)
+{
+    return localeTag.substr(0, localeTag.find(EXTENSION_SEPARATOR));
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
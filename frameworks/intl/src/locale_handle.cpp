@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "locale_handle.h"
+#include "locale_config.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// the options read by LocaleInfo, other formatter options do not change the parsed locale.
+const char *LocaleRegistry::LOCALE_OPTIONS[] = {
+    "script", "region", "hourCycle", "numberingSystem", "calendar", "collation", "caseFirst", "numeric"
+};
+
+LruCache<std::string, LocaleHandle> &LocaleRegistry::GetHandles()
+{
+    static LruCache<std::string, LocaleHandle> handles(CAPACITY);
+    return handles;
+}
+
+std::string LocaleRegistry::ComputeKey(const std::string &localeTag, const std::map<std::string, std::string> &configs)
+{
+    // LocaleInfo falls back to the system locale when the tag can not be built, so it is part of the key.
+    std::string key = localeTag;
+    key += '\0';
+    key += LocaleConfig::GetSystemLocale();
+    for (const char *option : LOCALE_OPTIONS) {
+        key += '\0';
+        auto iter = configs.find(option);
+        if (iter != configs.end()) {
+            key += '=';
+            key += iter->second;
+        }
+    }
+    return key;
+}
+
+LocaleHandle LocaleRegistry::Acquire(const std::string &localeTag, std::map<std::string, std::string> &configs)
+{
+    std::string key = ComputeKey(localeTag, configs);
+    LocaleHandle handle = nullptr;
+    if (GetHandles().Get(key, handle)) {
+        return handle;
+    }
+    handle = std::make_shared<const LocaleInfo>(localeTag, configs);
+    GetHandles().Put(key, handle);
+    return handle;
+}
+
+size_t LocaleRegistry::Size()
+{
+    return GetHandles().Size();
+}
+
+void LocaleRegistry::Clear()
+{
+    GetHandles().Clear();
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
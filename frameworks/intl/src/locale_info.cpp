@@ -14,45 +14,93 @@
  */
 #include "locale_info.h"
 #include <algorithm>
-#include "ohos/init_data.h"
+#include "icu_data.h"
 #include "locale_config.h"
+#include "locale_extension.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
 using namespace icu;
 
-std::set<std::string> LocaleInfo::allValidLocales = GetValidLocales();
+struct ExtensionKeyword {
+    const char *key;
+    const char *option;
+};
 
-std::set<std::string> LocaleInfo::GetValidLocales()
+// in the order the keywords are written into the final locale tag, indexed by LocaleInfo::ExtensionField.
+static const ExtensionKeyword EXTENSION_KEYWORDS[] = {
+    { "hc", "hourCycle" },
+    { "nu", "numberingSystem" },
+    { "ca", "calendar" },
+    { "co", "collation" },
+    { "kf", "caseFirst" },
+    { "kn", "numeric" },
+};
+// length of "-xx-" in front of each keyword value, or of "-u" and the subtag separators.
+static const size_t EXTENSION_SEPARATOR_LEN = 4;
+
+bool LocaleInfo::IsValidLanguage(const char *language)
+{
+    return GetValidLanguages().test(EncodeLanguage(language));
+}
+
+const std::bitset<LocaleInfo::LANGUAGE_SPACE> &LocaleInfo::GetValidLanguages()
+{
+    static const std::bitset<LANGUAGE_SPACE> validLanguages = InitValidLanguages();
+    return validLanguages;
+}
+
+std::bitset<LocaleInfo::LANGUAGE_SPACE> LocaleInfo::InitValidLanguages()
 {
+    InitIcuData();
     int32_t validCount = 1;
     const Locale *validLocales = Locale::getAvailableLocales(validCount);
-    std::set<std::string> allValidLocales;
+    std::bitset<LANGUAGE_SPACE> validLanguages;
     for (int i = 0; i < validCount; i++) {
-        allValidLocales.insert(validLocales[i].getLanguage());
+        validLanguages.set(EncodeLanguage(validLocales[i].getLanguage()));
+    }
+    validLanguages.set(EncodeLanguage("in"));
+    validLanguages.set(EncodeLanguage("iw"));
+    validLanguages.set(EncodeLanguage("tl"));
+    // code 0 stands for every tag that is not a 2 or 3 letter language.
+    validLanguages.reset(0);
+    return validLanguages;
+}
+
+uint32_t LocaleInfo::EncodeLanguage(const char *language)
+{
+    // a 2 or 3 letter lowercase language is a base 27 number, the letters being digits 1 to 26.
+    if (language == nullptr) {
+        return 0;
+    }
+    uint32_t code = 0;
+    size_t length = 0;
+    for (; language[length] != '\0'; ++length) {
+        if (length >= 3 || language[length] < 'a' || language[length] > 'z') {
+            return 0;
+        }
+        code = code * 27 + static_cast<uint32_t>(language[length] - 'a' + 1);
+    }
+    if (length == 2) {
+        code *= 27;
+    } else if (length != 3) {
+        return 0;
     }
-    allValidLocales.insert("in");
-    allValidLocales.insert("iw");
-    allValidLocales.insert("tl");
-    return allValidLocales;
+    return code;
 }
 
 LocaleInfo::LocaleInfo(std::string localeTag)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
-    configs = {};
-    ComputeFinalLocaleTag(localeTag);
-    std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
-    builder = std::make_unique<LocaleBuilder>();
-    Locale locale = builder->setLanguageTag(StringPiece(localeTag)).build(status);
+    ComputeFinalLocaleTag(localeTag, nullptr);
+    icu::LocaleBuilder builder;
+    Locale locale = builder.setLanguageTag(StringPiece(localeTag)).build(status);
     if (status != U_ZERO_ERROR) {
         std::string defaultLocaleTag = LocaleConfig::GetSystemLocale();
-        Locale defaultLocale(defaultLocaleTag.c_str());
-        locale = defaultLocale;
-
-        finalLocaleTag = "";
-        ComputeFinalLocaleTag(defaultLocaleTag);
+        locale = LocaleConfig::GetSystemIcuLocale();
+        ComputeFinalLocaleTag(defaultLocaleTag, nullptr);
     }
     language = locale.getLanguage();
     script = locale.getScript();
@@ -68,19 +116,23 @@ LocaleInfo::LocaleInfo(std::string localeTag)
 
 LocaleInfo::LocaleInfo(const std::string &localeTag, std::map<std::string, std::string> &configMap)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
-    configs = configMap;
-    std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
-    builder = std::make_unique<LocaleBuilder>();
+    icu::LocaleBuilder builder;
     if (localeTag != "") {
-        ComputeFinalLocaleTag(localeTag);
-        locale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
+        ComputeFinalLocaleTag(localeTag, &configMap);
+        locale = builder.setLanguageTag(StringPiece(finalLocaleTag)).build(status);
     }
     if (status != U_ZERO_ERROR || localeTag == "") {
         std::string defaultLocaleTag = LocaleConfig::GetSystemLocale();
-        finalLocaleTag = "";
-        ComputeFinalLocaleTag(defaultLocaleTag);
-        locale = builder->setLanguageTag(StringPiece(finalLocaleTag)).build(status);
+        ComputeFinalLocaleTag(defaultLocaleTag, &configMap);
+        // the parsed system locale is reused unless the options add keywords to it.
+        if (finalLocaleTag == defaultLocaleTag) {
+            locale = LocaleConfig::GetSystemIcuLocale();
+        } else {
+            status = U_ZERO_ERROR;
+            locale = builder.setLanguageTag(StringPiece(finalLocaleTag)).build(status);
+        }
     }
     language = locale.getLanguage();
     script = locale.getScript();
@@ -91,105 +143,74 @@ LocaleInfo::LocaleInfo(const std::string &localeTag, std::map<std::string, std::
 
 LocaleInfo::~LocaleInfo() {}
 
-void LocaleInfo::ComputeFinalLocaleTag(const std::string &localeTag)
+void LocaleInfo::ComputeFinalLocaleTag(const std::string &localeTag, const std::map<std::string, std::string> *configs)
 {
-    if (localeTag.find("-u-") == std::string::npos) {
-        finalLocaleTag = localeTag;
-        ParseConfigs();
-    } else {
-        finalLocaleTag = localeTag.substr(0, localeTag.find("-u-"));
-        ParseLocaleTag(localeTag);
-        ParseConfigs();
-    }
-    if (!script.empty()) {
-        finalLocaleTag += "-" + script;
-    }
-    if (!region.empty()) {
-        finalLocaleTag += "-" + region;
-    }
-    if (!hourCycle.empty() || !numberingSystem.empty() || !calendar.empty() || !collation.empty() ||
-        !caseFirst.empty() || !numeric.empty()) {
-        finalLocaleTag += "-u";
-    }
-    if (!hourCycle.empty()) {
-        finalLocaleTag += hourCycleTag + hourCycle;
-    }
-    if (!numberingSystem.empty()) {
-        finalLocaleTag += numberingSystemTag + numberingSystem;
-    }
-    if (!calendar.empty()) {
-        finalLocaleTag += calendarTag + calendar;
-    }
-    if (!collation.empty()) {
-        finalLocaleTag += collationTag + collation;
-    }
-    if (!caseFirst.empty()) {
-        finalLocaleTag += caseFirstTag + caseFirst;
-    }
-    if (!numeric.empty()) {
-        finalLocaleTag += numericTag + numeric;
-    }
-}
-
-void LocaleInfo::ParseLocaleTag(const std::string &localeTag)
-{
-    std::string flag = "-";
-    if (localeTag.find(hourCycleTag) != std::string::npos) {
-        hourCycle = localeTag.substr(localeTag.find(hourCycleTag) + CONFIG_TAG_LEN);
-        hourCycle = hourCycle.substr(0, hourCycle.find(flag));
+    // values not given by the tag or the configs are kept from the previous tag, they are views into the old
+    // finalLocaleTag which stays alive until the new one is built.
+    std::string_view values[EXTENSION_FIELD_COUNT];
+    for (size_t i = 0; i < EXTENSION_FIELD_COUNT; ++i) {
+        values[i] = std::string_view(finalLocaleTag).substr(extensions[i].begin, extensions[i].length);
+    }
+    size_t extensionStart = localeTag.find("-u-");
+    if (extensionStart != std::string::npos) {
+        LocaleExtension extension(localeTag);
+        for (size_t i = 0; i < EXTENSION_FIELD_COUNT; ++i) {
+            values[i] = extension.Find(EXTENSION_KEYWORDS[i].key);
+        }
     }
-    if (localeTag.find(numberingSystemTag) != std::string::npos) {
-        numberingSystem = localeTag.substr(localeTag.find(numberingSystemTag) + CONFIG_TAG_LEN);
-        numberingSystem = numberingSystem.substr(0, numberingSystem.find(flag));
+    if (configs != nullptr) {
+        auto iter = configs->find("script");
+        if (iter != configs->end()) {
+            script = iter->second;
+        }
+        iter = configs->find("region");
+        if (iter != configs->end()) {
+            region = iter->second;
+        }
+        for (size_t i = 0; i < EXTENSION_FIELD_COUNT; ++i) {
+            iter = configs->find(EXTENSION_KEYWORDS[i].option);
+            if (iter != configs->end()) {
+                values[i] = iter->second;
+            }
+        }
     }
-    if (localeTag.find(calendarTag) != std::string::npos) {
-        calendar = localeTag.substr(localeTag.find(calendarTag) + CONFIG_TAG_LEN);
-        calendar = calendar.substr(0, calendar.find(flag));
+    std::string_view base = std::string_view(localeTag).substr(0, extensionStart);
+    size_t length = base.length() + script.length() + region.length() + EXTENSION_SEPARATOR_LEN;
+    for (size_t i = 0; i < EXTENSION_FIELD_COUNT; ++i) {
+        length += values[i].length() + EXTENSION_SEPARATOR_LEN;
     }
-    if (localeTag.find(collationTag) != std::string::npos) {
-        collation = localeTag.substr(localeTag.find(collationTag) + CONFIG_TAG_LEN);
-        collation = collation.substr(0, collation.find(flag));
+    std::string tag;
+    tag.reserve(length);
+    tag.append(base);
+    if (!script.empty()) {
+        tag.append("-").append(script);
     }
-    if (localeTag.find(caseFirstTag) != std::string::npos) {
-        caseFirst = localeTag.substr(localeTag.find(caseFirstTag) + CONFIG_TAG_LEN);
-        caseFirst = caseFirst.substr(0, caseFirst.find(flag));
+    if (!region.empty()) {
+        tag.append("-").append(region);
     }
-    if (localeTag.find(numericTag) != std::string::npos) {
-        numeric = localeTag.substr(localeTag.find(numericTag) + CONFIG_TAG_LEN);
-        numeric = numeric.substr(0, numeric.find(flag));
+    bool hasExtension = false;
+    for (size_t i = 0; i < EXTENSION_FIELD_COUNT; ++i) {
+        extensions[i] = Span();
+        if (values[i].empty()) {
+            continue;
+        }
+        if (!hasExtension) {
+            tag.append("-u");
+            hasExtension = true;
+        }
+        tag.append("-").append(EXTENSION_KEYWORDS[i].key).append("-");
+        extensions[i].begin = static_cast<uint32_t>(tag.length());
+        extensions[i].length = static_cast<uint32_t>(values[i].length());
+        tag.append(values[i]);
     }
+    finalLocaleTag.swap(tag);
 }
 
-void LocaleInfo::ParseConfigs()
+std::string LocaleInfo::GetExtension(ExtensionField field) const
 {
-    if (configs.count("script") > 0) {
-        script = configs["script"];
-    }
-    if (configs.count("region") > 0) {
-        region = configs["region"];
-    }
-    if (configs.count("hourCycle") > 0) {
-        hourCycle = configs["hourCycle"];
-    }
-    if (configs.count("numberingSystem") > 0) {
-        numberingSystem = configs["numberingSystem"];
-    }
-    if (configs.count("calendar") > 0) {
-        calendar = configs["calendar"];
-    }
-    if (configs.count("collation") > 0) {
-        collation = configs["collation"];
-    }
-    if (configs.count("caseFirst") > 0) {
-        caseFirst = configs["caseFirst"];
-    }
-    if (configs.count("numeric") > 0) {
-        numeric = configs["numeric"];
-    }
+    return finalLocaleTag.substr(extensions[field].begin, extensions[field].length);
 }
 
-bool LocaleInfo::icuInitialized = LocaleInfo::Init();
-
 std::string LocaleInfo::GetLanguage() const
 {
     return language;
@@ -212,32 +233,32 @@ std::string LocaleInfo::GetBaseName() const
 
 std::string LocaleInfo::GetCalendar() const
 {
-    return calendar;
+    return GetExtension(CALENDAR);
 }
 
 std::string LocaleInfo::GetCollation() const
 {
-    return collation;
+    return GetExtension(COLLATION);
 }
 
 std::string LocaleInfo::GetHourCycle() const
 {
-    return hourCycle;
+    return GetExtension(HOUR_CYCLE);
 }
 
 std::string LocaleInfo::GetNumberingSystem() const
 {
-    return numberingSystem;
+    return GetExtension(NUMBERING_SYSTEM);
 }
 
 std::string LocaleInfo::GetNumeric() const
 {
-    return numeric;
+    return GetExtension(NUMERIC);
 }
 
 std::string LocaleInfo::GetCaseFirst() const
 {
-    return caseFirst;
+    return GetExtension(CASE_FIRST);
 }
 
 std::string LocaleInfo::ToString() const
@@ -285,12 +306,6 @@ std::string LocaleInfo::Minimize()
     }
     return finalLocaleTag;
 }
-
-bool LocaleInfo::Init()
-{
-    SetHwIcuDirectory();
-    return true;
-}
 } // namespace I18n
 } // namespace Global
 } // namespace OHOS
@@ -13,10 +13,13 @@
  * limitations under the License.
  */
 #include "measure_data.h"
+#include <algorithm>
 #include <string>
 #include <unordered_map>
 #include <cmath>
+#include "icu_data.h"
 #include "str_util.h"
+#include "unit_preferences_data.h"
 
 namespace OHOS {
 namespace Global {
@@ -28,144 +31,8 @@ const double FT3_TO_M3 = FT_TO_M * FT2_TO_M2;
 const double IN3_TO_M3 = FT3_TO_M3 / (12 * 12 * 12);
 const double GAL_IMP_TO_M3 = 0.00454609;
 const double GAL_TO_M3 = 231 * IN3_TO_M3;
-const int REGION_OFFSET = 7;
 const int BASE_VALUE_SIZE = 2;
-const int FACTOR_SIZE = 2;
-const int CHAR_OFFSET = 48;
-const int MAX_UNIT_NUM = 500;
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_001 {
-    { "area-land-agricult", { "hectare" } },
-    { "area-land-commercl", { "hectare" } },
-    { "area-land-residntl", { "hectare" } },
-    { "length-person", { "centimeter" } },
-    { "length-person-small", { "centimeter" } },
-    { "length-rainfall", { "millimeter" } },
-    { "length-road", { "meter" } },
-    { "length-road-small", { "meter" } },
-    { "length-snowfall", { "centimeter" } },
-    { "length-vehicle", { "meter" } },
-    { "length-visiblty", { "meter" } },
-    { "length-visiblty-small", { "meter" } },
-    { "speed-road-travel", { "kilometer-per-hour" } },
-    { "speed-wind", { "kilometer-per-hour" } },
-    { "temperature-person", { "celsius" } },
-    { "temperature-weather", { "celsius" } },
-    { "volume-vehicle-fuel", { "liter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_DEFAULT_001 {
-    { "length", { "kilometer", "meter", "centimeter" } },
-    { "area", { "square-kilometer", "hectare", "square-meter", "square-centimeter" } },
-    { "speed", { "kilometer-per-hour" } },
-    { "temperature", { "celsius" } },
-    { "volume", { "cubic-meter", "cubic-centimeter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_AT {
-    { "length-person", { "meter", "centimeter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_BR {
-    { "length-person-informal", { "meter", "centimeter" } },
-    { "length-rainfall", { "centimeter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_BS {
-    { "temperature-weather", { "fahrenheit" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_CA {
-    { "length-person", { "inch" } },
-    { "length-person-informal", { "foot", "inch" } },
-    { "length-person-small-informal", { "inch" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_CN {
-    { "length-person-informal", { "meter", "centimeter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_DE {
-    { "length-person-informal", { "meter", "centimeter" } },
-    { "length-visiblty", { "meter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_GB {
-    { "area-land-agricult", { "acre" } },
-    { "area-land-commercl", { "acre" } },
-    { "area-land-residntl", { "acre" } },
-    { "length-person", { "inch" } },
-    { "length-person-informal", { "foot", "inch" } },
-    { "length-person-small-informal", { "inch" } },
-    { "length-road", { "yard" } },
-    { "length-road-small", { "yard" } },
-    { "length-vehicle", { "foot", "inch" } },
-    { "length-visiblty", { "mile", "foot" } },
-    { "length-visiblty-small", { "foot" } },
-    { "speed-road-travel", { "mile-per-hour" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_DEFAULT_GB {
-    { "length", { "mile", "foot", "inch" } },
-    { "area", { "square-mile", "acre", "square-foot", "square-inch" } },
-    { "speed", { "mile-per-hour" } },
-    { "volume", { "cubic-foot", "cubic-inch" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_KR {
-    { "speed-wind", { "meter-per-second" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_MX {
-    { "length-person-informal", { "meter", "centimeter" } },
-    { "length-vehicle", { "meter", "centimeter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_NL {
-    { "length-person-informal", { "meter", "centimeter" } },
-    { "length-visiblty", { "meter" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_NO {
-    { "length-person-informal", { "meter", "centimeter" } },
-    { "speed-wind", { "meter-per-second" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_SE {
-    { "length-person", { "meter", "centimeter" } },
-    { "length-road", { "mile-scandinavian", "kilometer" } },
-    { "length-road-informal", { "mile-scandinavian" } },
-    { "speed-wind", { "meter-per-second" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_US {
-    { "area-land-agricult", { "acre" } },
-    { "area-land-commercl", { "acre" } },
-    { "area-land-residntl", { "acre" } },
-    { "length-person", { "inch" } },
-    { "length-person-informal", { "foot", "inch" } },
-    { "length-person-small", { "inch" } },
-    { "length-rainfall", { "inch" } },
-    { "length-road", { "mile" } },
-    { "length-road-small", { "foot" } },
-    { "length-snowfall", { "inch" } },
-    { "length-vehicle", { "foot", "inch" } },
-    { "length-visiblty", { "mile", "foot" } },
-    { "length-visiblty-small", { "foot" } },
-    { "speed-road-travel", { "mile-per-hour" } },
-    { "speed-wind", { "mile-per-hour" } },
-    { "temperature-person", { "fahrenheit" } },
-    { "temperature-weather", { "fahrenheit" } },
-    { "volume-vehicle-fuel", { "gallon" } },
-};
-
-const std::unordered_map<std::string, std::vector<std::string>> USAGE_DEFAULT_US {
-    { "length", { "mile", "foot", "inch" } },
-    { "area", { "square-mile", "acre", "square-foot", "square-inch" } },
-    { "speed", { "mile-per-hour" } },
-    { "temperature", { "fahrenheit" } },
-    { "volume", { "cubic-foot", "cubic-inch" } },
-};
+const std::string_view MIXED_UNIT_SEPARATOR = "-and-";
 
 const std::unordered_map<std::string, std::vector<double>> CONVERT_FACTORS {
     { "acre", { FT2_TO_M2 * 43560, 0 } },
@@ -288,186 +155,89 @@ const std::unordered_map<std::string, double> POWER_VALUE {
     { "cubic-", 3 },
 };
 
-uint32_t GetMask(const string &region)
+constexpr bool IsSortedRows(const UnitPreferenceRow *rows, size_t count)
 {
-    uint32_t firstChar = (region.c_str()[0] - CHAR_OFFSET);
-    uint32_t secondChar = (region.c_str()[1] - CHAR_OFFSET);
-    return (firstChar << REGION_OFFSET) | secondChar;
+    for (size_t i = 1; i < count; ++i) {
+        if (!(rows[i - 1].usage < rows[i].usage ||
+            (rows[i - 1].usage == rows[i].usage && rows[i - 1].region < rows[i].region))) {
+            return false;
+        }
+    }
+    return true;
 }
 
-void GetDefaultPreferredUnit(const string &region, const string &type, vector<string> &units)
+static_assert(IsSortedRows(UNIT_PREFERENCE_ROWS, sizeof(UNIT_PREFERENCE_ROWS) / sizeof(UNIT_PREFERENCE_ROWS[0])),
+    "UNIT_PREFERENCE_ROWS must be sorted by usage and region");
+static_assert(IsSortedTable(UNIT_CATEGORIES), "UNIT_CATEGORIES must be sorted");
+
+// index of the first row not ordered before (usage, region).
+static size_t LowerBoundRow(std::string_view usage, std::string_view region)
 {
-    switch (GetMask(region)) {
-        case 0x00000B92: {
-            if (USAGE_DEFAULT_GB.count(type) > 0) {
-                units.assign(USAGE_DEFAULT_GB.at(type).begin(), USAGE_DEFAULT_GB.at(type).end());
-            }
-            break;
-        }
-        case 0x000012A3: {
-            if (USAGE_DEFAULT_US.count(type) > 0) {
-                units.assign(USAGE_DEFAULT_US.at(type).begin(), USAGE_DEFAULT_US.at(type).end());
-            }
-            break;
-        }
-        default: {
-            if (USAGE_DEFAULT_001.count(type) > 0) {
-                units.assign(USAGE_DEFAULT_001.at(type).begin(), USAGE_DEFAULT_001.at(type).end());
-            }
-            break;
+    size_t low = 0;
+    size_t high = sizeof(UNIT_PREFERENCE_ROWS) / sizeof(UNIT_PREFERENCE_ROWS[0]);
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const UnitPreferenceRow &row = UNIT_PREFERENCE_ROWS[mid];
+        if (row.usage < usage || (row.usage == usage && row.region < region)) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
     }
+    return low;
 }
 
-void GetFallbackPreferredUnit(const string &region, const string &usage, vector<string> &units)
+static const UnitPreferenceRow *FindRow(std::string_view usage, std::string_view region)
 {
-    switch (GetMask(region)) {
-        case 0x00000EA8: {
-            if (USAGE_MX.count(usage) > 0) {
-                units.assign(USAGE_MX.at(usage).begin(), USAGE_MX.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000F1C: {
-            if (USAGE_NL.count(usage) > 0) {
-                units.assign(USAGE_NL.at(usage).begin(), USAGE_NL.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000F1F:
-        case 0x0000101C:
-        case 0x00001125: {
-            if (USAGE_NO.count(usage) > 0) {
-                units.assign(USAGE_NO.at(usage).begin(), USAGE_NO.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00001195: {
-            if (USAGE_SE.count(usage) > 0) {
-                units.assign(USAGE_SE.at(usage).begin(), USAGE_SE.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x000012A3: {
-            if (USAGE_US.count(usage) > 0) {
-                units.assign(USAGE_US.at(usage).begin(), USAGE_US.at(usage).end());
-                return;
-            }
-            break;
-        }
-        default: {
-            if (USAGE_001.count(usage) > 0) {
-                units.assign(USAGE_001.at(usage).begin(), USAGE_001.at(usage).end());
-                return;
-            }
-            break;
-        }
+    size_t index = LowerBoundRow(usage, region);
+    if (index == sizeof(UNIT_PREFERENCE_ROWS) / sizeof(UNIT_PREFERENCE_ROWS[0])) {
+        return nullptr;
     }
+    const UnitPreferenceRow &row = UNIT_PREFERENCE_ROWS[index];
+    return (row.usage == usage && row.region == region) ? &row : nullptr;
 }
 
-void GetRestPreferredUnit(const string &region, const string &usage, vector<string> &units)
+UnitPreferences GetUnitPreferences(const string &region, const string &usage)
 {
-    switch (GetMask(region)) {
-        case 0x00000991:
-        case 0x00000C9E: {
-            if (USAGE_CA.count(usage) > 0) {
-                units.assign(USAGE_CA.at(usage).begin(), USAGE_CA.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x0000099E:
-        case 0x00000A1B:
-        case 0x00001024: {
-            if (USAGE_CN.count(usage) > 0) {
-                units.assign(USAGE_CN.at(usage).begin(), USAGE_CN.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000A15: {
-            if (USAGE_DE.count(usage) > 0) {
-                units.assign(USAGE_DE.at(usage).begin(), USAGE_DE.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000B92: {
-            if (USAGE_GB.count(usage) > 0) {
-                units.assign(USAGE_GB.at(usage).begin(), USAGE_GB.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000DA2: {
-            if (USAGE_KR.count(usage) > 0) {
-                units.assign(USAGE_KR.at(usage).begin(), USAGE_KR.at(usage).end());
-                return;
-            }
-            break;
-        }
-        default: {
-            GetFallbackPreferredUnit(region, usage, units);
+    // the category is the longest prefix of usage known as one, like year-duration of year-duration-person-age.
+    std::string_view key(usage);
+    std::string_view defaultKey;
+    size_t categoryLength = key.rfind('-');
+    while (categoryLength != std::string_view::npos) {
+        defaultKey = TableFind(UNIT_CATEGORIES, key.substr(0, categoryLength));
+        if (!defaultKey.empty() || !categoryLength) {
             break;
         }
+        categoryLength = key.rfind('-', categoryLength - 1);
+    }
+    UnitPreferences preferences = { nullptr, 0 };
+    if (defaultKey.empty()) {
+        return preferences;
     }
-    if (!units.size()) {
-        GetFallbackPreferredUnit(region, usage, units);
+    // same as icu, an unknown usage falls back to its parent usage and finally to the category default, then the
+    // region falls back to the world.
+    while (FindRow(key, "001") == nullptr) {
+        size_t pos = key.rfind('-');
+        key = (pos > categoryLength) ? key.substr(0, pos) : defaultKey;
     }
+    const UnitPreferenceRow *row = FindRow(key, region);
+    if (row == nullptr) {
+        row = FindRow(key, "001");
+    }
+    preferences.units = UNIT_PREFERENCES + row->first;
+    preferences.count = row->count;
+    return preferences;
 }
 
-void GetPreferredUnit(const string &region, const string &usage, vector<string> &units)
+void SplitMixedUnit(std::string_view unit, std::vector<std::string> &units)
 {
-    switch (GetMask(region)) {
-        case 0x000008A4:
-        case 0x00000915:
-        case 0x00000A2A:
-        case 0x00000A97:
-        case 0x00000AA3:
-        case 0x00000B22:
-        case 0x00000C1B:
-        case 0x00000C94:
-        case 0x00000C9C:
-        case 0x00000CA4:
-        case 0x00000D1F:
-        case 0x00000EA9:
-        case 0x00001191:
-        case 0x00001222:
-        case 0x0000131E: {
-            if (USAGE_AT.count(usage) > 0) {
-                units.assign(USAGE_AT.at(usage).begin(), USAGE_AT.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000922: {
-            if (USAGE_BR.count(usage) > 0) {
-                units.assign(USAGE_BR.at(usage).begin(), USAGE_BR.at(usage).end());
-                return;
-            }
-            break;
-        }
-        case 0x00000923:
-        case 0x0000092A:
-        case 0x00001022:
-        case 0x00001027: {
-            if (USAGE_BS.count(usage) > 0) {
-                units.assign(USAGE_BS.at(usage).begin(), USAGE_BS.at(usage).end());
-                return;
-            }
-            break;
-        }
-        default: {
-            GetRestPreferredUnit(region, usage, units);
-            break;
-        }
-    }
-    if (!units.size()) {
-        GetRestPreferredUnit(region, usage, units);
+    units.clear();
+    size_t begin = 0;
+    while (begin <= unit.length()) {
+        size_t end = unit.find(MIXED_UNIT_SEPARATOR, begin);
+        end = (end == std::string_view::npos) ? unit.length() : end;
+        units.emplace_back(unit.substr(begin, end - begin));
+        begin = end + MIXED_UNIT_SEPARATOR.length();
     }
 }
 
@@ -545,44 +315,146 @@ int ComputeValue(const string &unit, const string &measSys, vector<double> &fact
     return 1;
 }
 
-int Convert(double &value, const string &fromUnit, const string &fromMeasSys, const string &toUnit,
-    const string &toMeasSys)
+static unordered_map<string, icu::MeasureUnit> InitMeasureUnits()
+{
+    InitIcuData();
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t count = icu::MeasureUnit::getAvailable(nullptr, 0, status);
+    status = U_ZERO_ERROR;
+    vector<icu::MeasureUnit> units(count > 0 ? count : 0);
+    icu::MeasureUnit::getAvailable(units.data(), count, status);
+    unordered_map<string, icu::MeasureUnit> measureUnits;
+    if (U_FAILURE(status)) {
+        return measureUnits;
+    }
+    for (const icu::MeasureUnit &unit : units) {
+        measureUnits[unit.getSubtype()] = unit;
+    }
+    return measureUnits;
+}
+
+// all the units known to icu indexed by subtype, built on first use and never modified afterwards.
+const unordered_map<string, icu::MeasureUnit> &GetMeasureUnits()
+{
+    static const unordered_map<string, icu::MeasureUnit> measureUnits = InitMeasureUnits();
+    return measureUnits;
+}
+
+const icu::MeasureUnit *FindMeasureUnit(const string &subtype)
 {
-    double baseResult = 0.0;
-    double result = 0.0;
-    vector<double> fromFactors = {0.0, 0.0};
-    string fromUnitType;
-    string toUnitType;
-    icu::MeasureUnit unitArray[MAX_UNIT_NUM];
-    UErrorCode icuStatus = U_ZERO_ERROR;
-    icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, icuStatus);
-    for (icu::MeasureUnit curUnit : unitArray) {
-        if (!strcmp(curUnit.getSubtype(), fromUnit.c_str())) {
-            fromUnitType = curUnit.getType();
+    const unordered_map<string, icu::MeasureUnit> &measureUnits = GetMeasureUnits();
+    auto iter = measureUnits.find(subtype);
+    return (iter == measureUnits.end()) ? nullptr : &iter->second;
+}
+
+// conversions of a unit, those of the measurement systems changing the result are listed apart.
+struct UnitConversions {
+    UnitConversion conversion;
+    bool valid;
+    vector<pair<string, UnitConversion>> systems;
+    vector<string> invalidSystems;
+};
+
+static void CollectMeasSystems(vector<string> &measSystems)
+{
+    // ComputeFactorValue looks up unit + "-" + measSys, so only the tails of the factor keys can change a result.
+    measSystems.push_back("");
+    for (auto &factor : CONVERT_FACTORS) {
+        for (size_t pos = factor.first.find('-'); pos != string::npos; pos = factor.first.find('-', pos + 1)) {
+            string measSys = factor.first.substr(pos + 1);
+            if (find(measSystems.begin(), measSystems.end(), measSys) == measSystems.end()) {
+                measSystems.push_back(measSys);
+            }
         }
-        if (!strcmp(curUnit.getSubtype(), toUnit.c_str())) {
-            toUnitType = curUnit.getType();
+    }
+}
+
+static unordered_map<string, UnitConversions> InitUnitConversions()
+{
+    vector<string> measSystems;
+    CollectMeasSystems(measSystems);
+    unordered_map<string, uint32_t> typeIds;
+    unordered_map<string, UnitConversions> conversions;
+    for (auto &measureUnit : GetMeasureUnits()) {
+        uint32_t typeId = typeIds.insert(make_pair(string(measureUnit.second.getType()),
+            static_cast<uint32_t>(typeIds.size()))).first->second;
+        UnitConversions &unitConversions = conversions[measureUnit.first];
+        for (const string &measSys : measSystems) {
+            vector<double> factors = { 0.0, 0.0 };
+            bool valid = ComputeValue(measureUnit.first, measSys, factors);
+            UnitConversion conversion = { typeId, factors[0], factors[1] };
+            if (measSys.empty()) {
+                unitConversions.conversion = conversion;
+                unitConversions.valid = valid;
+            } else if (!valid && unitConversions.valid) {
+                unitConversions.invalidSystems.push_back(measSys);
+            } else if (valid && (!unitConversions.valid || conversion.factor != unitConversions.conversion.factor ||
+                conversion.offset != unitConversions.conversion.offset)) {
+                unitConversions.systems.push_back(make_pair(measSys, conversion));
+            }
         }
     }
-    if (fromUnitType.empty() || toUnitType.empty() || strcmp(fromUnitType.c_str(), toUnitType.c_str())) {
-        return 0;
+    return conversions;
+}
+
+// the conversion of every unit known to icu in every measurement system, computed once on first use.
+const UnitConversion *FindUnitConversion(const string &unit, const string &measSys)
+{
+    static const unordered_map<string, UnitConversions> conversions = InitUnitConversions();
+    auto iter = conversions.find(unit);
+    if (iter == conversions.end()) {
+        return nullptr;
     }
-    int status = ComputeValue(fromUnit, fromMeasSys, fromFactors);
-    if (!status) {
-        return 0;
+    const UnitConversions &unitConversions = iter->second;
+    for (auto &system : unitConversions.systems) {
+        if (system.first == measSys) {
+            return &system.second;
+        }
     }
-    vector<double> toFactors = {0.0, 0.0};
-    status = ComputeValue(toUnit, toMeasSys, toFactors);
-    if (!status) {
+    if (!unitConversions.valid) {
+        return nullptr;
+    }
+    for (const string &invalidSystem : unitConversions.invalidSystems) {
+        if (invalidSystem == measSys) {
+            return nullptr;
+        }
+    }
+    return &unitConversions.conversion;
+}
+
+double ApplyUnitConversion(double value, const UnitConversion &from, const UnitConversion &to)
+{
+    return (fma(from.factor, value, from.offset) - to.offset) / to.factor;
+}
+
+int Convert(double &value, const string &fromUnit, const string &fromMeasSys, const string &toUnit,
+    const string &toMeasSys)
+{
+    const UnitConversion *from = FindUnitConversion(fromUnit, fromMeasSys);
+    const UnitConversion *to = FindUnitConversion(toUnit, toMeasSys);
+    if (!from || !to || from->typeId != to->typeId) {
         return 0;
     }
-    if (fromFactors.size() == FACTOR_SIZE) {
-        baseResult = fromFactors[0] * value + fromFactors[1];
+    value = ApplyUnitConversion(value, *from, *to);
+    return 1;
+}
+
+int ConvertBatch(const double *in, double *out, size_t count, const string &fromUnit, const string &fromMeasSys,
+    const string &toUnit, const string &toMeasSys)
+{
+    const UnitConversion *from = FindUnitConversion(fromUnit, fromMeasSys);
+    const UnitConversion *to = FindUnitConversion(toUnit, toMeasSys);
+    if (!from || !to || from->typeId != to->typeId || (count && (!in || !out))) {
+        return 0;
     }
-    if (toFactors.size() == FACTOR_SIZE) {
-        result = (baseResult - toFactors[1]) / toFactors[0];
+    // the factors are copied to locals, so the loop body only loads in[i] besides the arithmetic.
+    double fromFactor = from->factor;
+    double offset = from->offset;
+    double toOffset = to->offset;
+    double toFactor = to->factor;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (fma(fromFactor, in[i], offset) - toOffset) / toFactor;
     }
-    value = result;
     return 1;
 }
 } // namespace I18n
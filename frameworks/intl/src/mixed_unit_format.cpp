@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mixed_unit_format.h"
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+// ratios this close to an integer, like 12 inches in a foot, are taken as that integer.
+const double INTEGRAL_RATIO_TOLERANCE = 1e-9;
+// significant digits kept by the default rounding of icu for a usage, which rounds to integers otherwise.
+const int32_t CLDR_MIN_DIGITS = 2;
+
+UListFormatterWidth GetListWidth(UNumberUnitWidth width)
+{
+    switch (width) {
+        case UNumberUnitWidth::UNUM_UNIT_WIDTH_NARROW:
+            return ULISTFMT_WIDTH_NARROW;
+        case UNumberUnitWidth::UNUM_UNIT_WIDTH_FULL_NAME:
+            return ULISTFMT_WIDTH_WIDE;
+        default:
+            return ULISTFMT_WIDTH_SHORT;
+    }
+}
+
+std::shared_ptr<const MixedUnitFormat> MixedUnitFormat::Create(const icu::Locale &locale,
+    const UnitPreferences &preferences, const std::string &unit, const std::string &measSys,
+    const icu::number::LocalizedNumberFormatter &formatter, UNumberUnitWidth width, bool cldrPrecision)
+{
+    const UnitConversion *conversion = FindUnitConversion(unit, measSys);
+    if (conversion == nullptr || preferences.count == 0) {
+        return nullptr;
+    }
+    std::shared_ptr<MixedUnitFormat> format(new MixedUnitFormat());
+    format->conversion = *conversion;
+    bool routed = false;
+    for (size_t i = 0; i < preferences.count; ++i) {
+        Preference preference = { preferences.units[i].geq, {} };
+        if (!InitPreference(preferences.units[i], conversion->typeId, measSys, formatter, cldrPrecision,
+            preference)) {
+            return nullptr;
+        }
+        routed = routed || (preference.components.size() > 1) || (preferences.units[i].increment > 0);
+        format->preferences.push_back(preference);
+    }
+    if (!routed) {
+        return nullptr;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    format->listFormat.reset(icu::ListFormatter::createInstance(locale, ULISTFMT_TYPE_UNITS, GetListWidth(width),
+        status));
+    if (U_FAILURE(status) || format->listFormat == nullptr) {
+        return nullptr;
+    }
+    return format;
+}
+
+icu::number::Precision MixedUnitFormat::GetCldrPrecision(double increment)
+{
+    if (increment > 0) {
+        return icu::number::Precision::increment(increment);
+    }
+    return icu::number::Precision::integer().withMinDigits(CLDR_MIN_DIGITS);
+}
+
+bool MixedUnitFormat::InitPreference(const UnitPreference &unit, uint32_t typeId, const std::string &measSys,
+    const icu::number::LocalizedNumberFormatter &formatter, bool cldrPrecision, Preference &preference)
+{
+    std::vector<std::string> units;
+    SplitMixedUnit(unit.unit, units);
+    if (units.empty() || units.size() > MAX_COMPONENTS) {
+        return false;
+    }
+    double previousFactor = 1.0;
+    for (size_t i = 0; i < units.size(); ++i) {
+        const UnitConversion *conversion = FindUnitConversion(units[i], measSys);
+        const icu::MeasureUnit *measureUnit = FindMeasureUnit(units[i]);
+        if (conversion == nullptr || measureUnit == nullptr || conversion->typeId != typeId ||
+            conversion->offset != 0) {
+            return false;
+        }
+        double ratio = (i == 0) ? conversion->factor : (previousFactor / conversion->factor);
+        if (i > 0 && fabs(ratio - round(ratio)) < INTEGRAL_RATIO_TOLERANCE * ratio) {
+            ratio = round(ratio);
+        }
+        previousFactor = conversion->factor;
+        // only the last unit shows a fraction, the units before it hold the integral part.
+        icu::number::LocalizedNumberFormatter unitFormat = formatter.unit(*measureUnit);
+        if (i + 1 < units.size()) {
+            unitFormat = unitFormat.precision(icu::number::Precision::integer());
+        } else if (cldrPrecision) {
+            unitFormat = unitFormat.precision(GetCldrPrecision(unit.increment));
+        }
+        preference.components.push_back({ ratio,
+            std::make_shared<const icu::number::LocalizedNumberFormatter>(unitFormat) });
+    }
+    return true;
+}
+
+bool MixedUnitFormat::Format(double number, icu::UnicodeString &result) const
+{
+    icu::number::FormattedNumber items[MAX_COMPONENTS];
+    size_t count = 0;
+    icu::FormattedList list;
+    if (!FormatToValue(number, items, count, list)) {
+        return false;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    icu::UnicodeString formatted = list.toString(status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    result = formatted;
+    return true;
+}
+
+bool MixedUnitFormat::FormatToValue(double number, icu::number::FormattedNumber *items, size_t &count,
+    icu::FormattedList &list) const
+{
+    double baseValue = fma(conversion.factor, number, conversion.offset);
+    if (!std::isfinite(baseValue)) {
+        return false;
+    }
+    bool negative = std::signbit(baseValue);
+    baseValue = fabs(baseValue);
+    // the first preference reaching its limit in its leading unit is taken, otherwise the last one. values are
+    // nudged up by an epsilon like icu does, so a value converted to exactly the limit is not missed.
+    const Preference *preference = &preferences.back();
+    for (const Preference &candidate : preferences) {
+        if (baseValue / candidate.components[0].ratio * (1 + DBL_EPSILON) >= candidate.geq) {
+            preference = &candidate;
+            break;
+        }
+    }
+    const Component *components = preference->components.data();
+    count = preference->components.size();
+    double amounts[MAX_COMPONENTS] = { 0 };
+    double quantity = baseValue / components[0].ratio;
+    for (size_t i = 0; i + 1 < count; ++i) {
+        amounts[i] = floor(quantity * (1 + DBL_EPSILON));
+        double remainder = quantity - amounts[i];
+        quantity = ((remainder <= 0) || (remainder / quantity < DBL_EPSILON)) ? 0 : remainder;
+        quantity *= components[i + 1].ratio;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    if (count == 1) {
+        items[0] = components[0].numberFormat->formatDouble(negative ? -quantity : quantity, status);
+    } else {
+        // the last unit is rounded by its formatter, rounding up to a whole unit before it carries into that unit.
+        const icu::number::LocalizedNumberFormatter *lastFormat = components[count - 1].numberFormat.get();
+        icu::number::FormattedNumber last = lastFormat->formatDouble(quantity, status);
+        double rounded = strtod(last.toDecimalNumber<std::string>(status).c_str(), nullptr);
+        if (rounded >= components[count - 1].ratio) {
+            last = lastFormat->formatDouble(rounded - components[count - 1].ratio, status);
+            amounts[count - 2] += 1;
+            for (size_t i = count - 2; i > 0 && amounts[i] >= components[i].ratio; --i) {
+                amounts[i] -= components[i].ratio;
+                amounts[i - 1] += 1;
+            }
+        }
+        items[count - 1] = std::move(last);
+        // the sign is shown once, on the first unit.
+        for (size_t i = 0; i + 1 < count; ++i) {
+            double amount = (i == 0 && negative) ? -amounts[i] : amounts[i];
+            items[i] = components[i].numberFormat->formatDouble(amount, status);
+        }
+    }
+    icu::UnicodeString strings[MAX_COMPONENTS];
+    for (size_t i = 0; i < count; ++i) {
+        strings[i] = items[i].toString(status);
+    }
+    list = listFormat->formatStringsToValue(strings, static_cast<int32_t>(count), status);
+    return U_SUCCESS(status);
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "notation_patterns.h"
+#include <cmath>
+#include "unicode/dcfmtsym.h"
+#include "unicode/strenum.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+const uint64_t POWERS_OF_TEN[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+const int32_t POWERS_OF_TEN_COUNT = sizeof(POWERS_OF_TEN) / sizeof(POWERS_OF_TEN[0]);
+// compact numbers show at most this many integer digits before the formatter falls back to icu.
+const uint64_t MAX_COMPACT_INTEGER = 10000;
+const double SELF_CHECK_VALUES[] = {
+    0, 1, 2, 5, 9, 10, 11, 12, 15, 21, 99, 100, 101, 110, 999, 1000, 1001, 1049, 1050, 1150, 1250, 1234, 1500,
+    2000, 9949, 9950, 9999, 10000, 10500, 12345, 21000, 99499, 99500, 99999, 100000, 123456, 999499, 999500,
+    999999, 1000000, 1234567, 2500000, 9999999, 12345678, 123456789, 1000000000, 987654321098,
+    1000000000000, 123456789012345, 999999999999999, -1, -5, -1234, -1000000, -123456789
+};
+
+int32_t GetDigitCount(uint64_t value)
+{
+    int32_t count = 1;
+    while (count < POWERS_OF_TEN_COUNT && value >= POWERS_OF_TEN[count]) {
+        ++count;
+    }
+    return count;
+}
+
+// value / 10^shift rounded half to even, or value * 10^-shift when shift is negative.
+uint64_t ShiftHalfEven(uint64_t value, int32_t shift)
+{
+    if (shift <= 0) {
+        return value * POWERS_OF_TEN[-shift];
+    }
+    if (shift >= POWERS_OF_TEN_COUNT) {
+        return 0;
+    }
+    uint64_t divisor = POWERS_OF_TEN[shift];
+    uint64_t quotient = value / divisor;
+    uint64_t remainder = value % divisor;
+    uint64_t half = divisor / 2;
+    if (remainder > half || (remainder == half && (quotient & 1))) {
+        ++quotient;
+    }
+    return quotient;
+}
+
+bool AppendToBuffer(const icu::UnicodeString &text, char16_t *buffer, int32_t &length)
+{
+    if (length + text.length() > NotationPatterns::MAX_STANDARD_LENGTH) {
+        return false;
+    }
+    text.extract(0, text.length(), buffer + length);
+    length += text.length();
+    return true;
+}
+
+NotationPatterns::NotationPatterns(const icu::Locale &locale, NotationType type) : type(type)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    icu::DecimalFormatSymbols symbols(locale, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t i = 0; i < 10; ++i) { // 10 is the count of decimal digits
+        digitSymbols[i] = symbols.getConstDigitSymbol(i);
+    }
+    decimalSeparator = symbols.getSymbol(icu::DecimalFormatSymbols::kDecimalSeparatorSymbol);
+    exponentSymbol = symbols.getSymbol(icu::DecimalFormatSymbols::kExponentialSymbol);
+    groupingSeparator = symbols.getSymbol(icu::DecimalFormatSymbols::kGroupingSeparatorSymbol);
+    icu::number::UnlocalizedNumberFormatter unlocalized = icu::number::NumberFormatter::with();
+    switch (type) {
+        case COMPACT_SHORT:
+            unlocalized = unlocalized.notation(icu::number::Notation::compactShort());
+            break;
+        case COMPACT_LONG:
+            unlocalized = unlocalized.notation(icu::number::Notation::compactLong());
+            break;
+        case SCIENTIFIC:
+            unlocalized = unlocalized.notation(icu::number::Notation::scientific());
+            break;
+        case STANDARD:
+            break;
+        default:
+            unlocalized = unlocalized.notation(icu::number::Notation::engineering());
+            break;
+    }
+    icu::number::LocalizedNumberFormatter formatter = unlocalized.locale(locale);
+    if (type == SCIENTIFIC || type == ENGINEERING) {
+        InitScientific(formatter);
+    } else if (type == STANDARD) {
+        InitStandard(formatter);
+    } else {
+        pluralRules.reset(icu::PluralRules::forLocale(locale, status));
+        if (U_FAILURE(status) || pluralRules == nullptr) {
+            return;
+        }
+        std::unique_ptr<icu::StringEnumeration> pluralKeywords(pluralRules->getKeywords(status));
+        if (U_FAILURE(status) || pluralKeywords == nullptr) {
+            return;
+        }
+        const icu::UnicodeString *keyword = nullptr;
+        while ((keyword = pluralKeywords->snext(status)) != nullptr && U_SUCCESS(status)) {
+            keywords.push_back(*keyword);
+        }
+        InitCompact(formatter);
+    }
+    valid = valid && SelfCheck(formatter);
+}
+
+LruCache<std::string, std::shared_ptr<const NotationPatterns>> &NotationPatterns::GetPatterns()
+{
+    static LruCache<std::string, std::shared_ptr<const NotationPatterns>> patterns(CAPACITY);
+    return patterns;
+}
+
+std::shared_ptr<const NotationPatterns> NotationPatterns::Acquire(const icu::Locale &locale, NotationType type)
+{
+    std::string key = locale.getName();
+    key += '\0';
+    key += static_cast<char>('0' + type);
+    std::shared_ptr<const NotationPatterns> patterns = nullptr;
+    if (GetPatterns().Get(key, patterns)) {
+        return patterns;
+    }
+    patterns = std::make_shared<const NotationPatterns>(locale, type);
+    GetPatterns().Put(key, patterns);
+    return patterns;
+}
+
+void NotationPatterns::InitCompact(const icu::number::LocalizedNumberFormatter &formatter)
+{
+    // the multiplier of a magnitude is read from the integer digits icu shows for its power of ten.
+    for (int32_t magnitude = 0; magnitude <= MAX_MAGNITUDE; ++magnitude) {
+        multipliers[magnitude] = INVALID_MULTIPLIER;
+        UErrorCode status = U_ZERO_ERROR;
+        icu::number::FormattedNumber formatted =
+            formatter.formatDouble(static_cast<double>(POWERS_OF_TEN[magnitude]), status);
+        icu::UnicodeString text = formatted.toString(status);
+        icu::ConstrainedFieldPosition position;
+        position.constrainField(UFIELD_CATEGORY_NUMBER, UNUM_INTEGER_FIELD);
+        if (U_FAILURE(status) || !formatted.nextPosition(position, status) || U_FAILURE(status)) {
+            continue;
+        }
+        icu::UnicodeString integer = text.tempSubStringBetween(position.getStart(), position.getLimit());
+        for (int32_t shown = 0; shown <= magnitude; ++shown) {
+            icu::UnicodeString core;
+            AppendDecimal(POWERS_OF_TEN[shown], 0, core);
+            if (core == integer) {
+                multipliers[magnitude] = shown - magnitude;
+                break;
+            }
+        }
+    }
+    size_t classCount = KEYWORD_CLASS_BASE + keywords.size();
+    compactAffixes.resize(classCount * (MAX_MAGNITUDE + 1));
+    for (int32_t magnitude = 0; magnitude <= MAX_MAGNITUDE; ++magnitude) {
+        InitCompactMagnitude(formatter, magnitude);
+    }
+    valid = true;
+}
+
+void NotationPatterns::InitCompactMagnitude(const icu::number::LocalizedNumberFormatter &formatter,
+    int32_t magnitude)
+{
+    uniformClasses[magnitude] = -1;
+    int32_t multiplier = multipliers[magnitude];
+    int32_t shown = magnitude + multiplier;
+    // patterns showing more than three integer digits are left to icu.
+    if (multiplier == INVALID_MULTIPLIER || multiplier > 0 || shown < 0 || shown > 2) { // 2 is the largest magnitude
+        return;
+    }
+    // every number a pattern of the magnitude can show, as digits with one fraction digit or none.
+    uint64_t first = POWERS_OF_TEN[shown];
+    uint64_t last = POWERS_OF_TEN[shown + 1];
+    int32_t fractionDigits = 0;
+    if (magnitude == 0) {
+        first = 0;
+    } else if (shown == 0) {
+        first = 10; // numbers from 1.0 to 9.9
+        last = 100;
+        fractionDigits = 1;
+    }
+    size_t classCount = KEYWORD_CLASS_BASE + keywords.size();
+    Affixes *affixes = &compactAffixes[magnitude * classCount];
+    std::vector<bool> probed(classCount, false);
+    bool uniform = true;
+    int32_t firstClass = -1;
+    for (uint64_t number = first; number < last; ++number) {
+        uint64_t digits = number;
+        int32_t digitsFraction = fractionDigits;
+        if (digitsFraction > 0 && digits % 10 == 0) { // 10 strips the trailing zero
+            digits /= 10;
+            digitsFraction = 0;
+        }
+        int32_t pluralClass = GetPluralClass(digits, digitsFraction);
+        if (pluralClass < 0) {
+            uniform = false;
+            continue;
+        }
+        if (probed[pluralClass]) {
+            continue;
+        }
+        probed[pluralClass] = true;
+        icu::UnicodeString core;
+        AppendDecimal(digits, digitsFraction, core);
+        double input = static_cast<double>(digits * POWERS_OF_TEN[-multiplier - digitsFraction]);
+        if (!ProbeAffixes(formatter, input, core, affixes[pluralClass])) {
+            uniform = false;
+            continue;
+        }
+        if (firstClass < 0) {
+            firstClass = pluralClass;
+            continue;
+        }
+        const Affixes &expected = affixes[firstClass];
+        const Affixes &actual = affixes[pluralClass];
+        if (actual.prefix != expected.prefix || actual.suffix != expected.suffix ||
+            actual.negativePrefix != expected.negativePrefix || actual.negativeSuffix != expected.negativeSuffix) {
+            uniform = false;
+        }
+    }
+    if (uniform) {
+        uniformClasses[magnitude] = firstClass;
+    }
+}
+
+void NotationPatterns::InitScientific(const icu::number::LocalizedNumberFormatter &formatter)
+{
+    icu::UnicodeString core;
+    AppendDecimal(1, 0, core);
+    core += exponentSymbol;
+    AppendDecimal(0, 0, core);
+    valid = ProbeAffixes(formatter, 1, core, plainAffixes);
+}
+
+void NotationPatterns::InitStandard(const icu::number::LocalizedNumberFormatter &formatter)
+{
+    for (int32_t magnitude = 0; magnitude <= MAX_MAGNITUDE; ++magnitude) {
+        groupingMasks[magnitude] = ProbeGrouping(formatter, magnitude);
+    }
+    icu::UnicodeString core;
+    AppendDecimal(1, 0, core);
+    valid = ProbeAffixes(formatter, 1, core, plainAffixes);
+}
+
+uint32_t NotationPatterns::ProbeGrouping(const icu::number::LocalizedNumberFormatter &formatter,
+    int32_t magnitude) const
+{
+    // the grouping only depends on the count of digits, it is read from the power of ten of the magnitude.
+    UErrorCode status = U_ZERO_ERROR;
+    icu::number::FormattedNumber formatted =
+        formatter.formatDouble(static_cast<double>(POWERS_OF_TEN[magnitude]), status);
+    icu::UnicodeString text = formatted.toString(status);
+    icu::ConstrainedFieldPosition position;
+    position.constrainField(UFIELD_CATEGORY_NUMBER, UNUM_INTEGER_FIELD);
+    if (U_FAILURE(status) || !formatted.nextPosition(position, status) || U_FAILURE(status)) {
+        return INVALID_GROUPING;
+    }
+    uint32_t mask = 0;
+    int32_t remaining = magnitude + 1;
+    int32_t index = position.getStart();
+    while (index < position.getLimit()) {
+        const icu::UnicodeString &digit = digitSymbols[(remaining == magnitude + 1) ? 1 : 0];
+        if (remaining > 0 && text.compare(index, digit.length(), digit) == 0) {
+            index += digit.length();
+            --remaining;
+        } else if (remaining > 0 && remaining <= magnitude && !groupingSeparator.isEmpty() &&
+            text.compare(index, groupingSeparator.length(), groupingSeparator) == 0) {
+            index += groupingSeparator.length();
+            mask |= 1U << remaining;
+        } else {
+            return INVALID_GROUPING;
+        }
+    }
+    return remaining ? INVALID_GROUPING : mask;
+}
+
+bool NotationPatterns::ProbeAffixes(const icu::number::LocalizedNumberFormatter &formatter, double number,
+    const icu::UnicodeString &core, Affixes &affixes) const
+{
+    UErrorCode status = U_ZERO_ERROR;
+    icu::UnicodeString positive = formatter.formatDouble(number, status).toString(status);
+    icu::UnicodeString negative = formatter.formatDouble(-number, status).toString(status);
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    int32_t positiveIndex = positive.indexOf(core);
+    int32_t negativeIndex = negative.indexOf(core);
+    if (positiveIndex < 0 || negativeIndex < 0) {
+        return false;
+    }
+    // setTo copies, the temporary substrings of icu alias the local results.
+    affixes.prefix.setTo(positive, 0, positiveIndex);
+    affixes.suffix.setTo(positive, positiveIndex + core.length());
+    affixes.negativePrefix.setTo(negative, 0, negativeIndex);
+    affixes.negativeSuffix.setTo(negative, negativeIndex + core.length());
+    affixes.valid = true;
+    return true;
+}
+
+bool NotationPatterns::SelfCheck(const icu::number::LocalizedNumberFormatter &formatter) const
+{
+    for (double number : SELF_CHECK_VALUES) {
+        icu::UnicodeString result;
+        if (!Format(number, result)) {
+            continue;
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        icu::UnicodeString expected = formatter.formatDouble(number, status).toString(status);
+        if (U_FAILURE(status) || result != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t NotationPatterns::GetMagnitude(const Rounded &rounded)
+{
+    return GetDigitCount(rounded.digits) - 1 - rounded.fractionDigits;
+}
+
+int32_t NotationPatterns::GetMultiplier(int32_t magnitude) const
+{
+    if (type == SCIENTIFIC || type == ENGINEERING) {
+        int32_t interval = (type == ENGINEERING) ? 3 : 1; // engineering exponents are multiples of 3
+        int32_t digitsShown = ((magnitude % interval + interval) % interval) + 1;
+        return digitsShown - magnitude - 1;
+    }
+    if (magnitude < 0) {
+        return 0;
+    }
+    return multipliers[(magnitude > MAX_MAGNITUDE) ? MAX_MAGNITUDE : magnitude];
+}
+
+NotationPatterns::Rounded NotationPatterns::Round(uint64_t value, int32_t multiplier) const
+{
+    Rounded rounded = { 0, 0, multiplier };
+    if (!value) {
+        return rounded;
+    }
+    // compact numbers keep two significant digits when they have a single integer digit, the mantissas of
+    // scientific numbers keep a fixed count of fraction digits.
+    int32_t fractionDigits = MAX_SCIENTIFIC_FRACTION;
+    if (type == COMPACT_SHORT || type == COMPACT_LONG) {
+        int32_t magnitude = GetDigitCount(value) - 1 + multiplier;
+        fractionDigits = (magnitude >= 1) ? 0 : (1 - magnitude);
+    }
+    rounded.digits = ShiftHalfEven(value, -multiplier - fractionDigits);
+    rounded.fractionDigits = fractionDigits;
+    while (rounded.fractionDigits > 0 && rounded.digits % 10 == 0) { // 10 strips a trailing zero
+        rounded.digits /= 10;
+        --rounded.fractionDigits;
+    }
+    return rounded;
+}
+
+NotationPatterns::Rounded NotationPatterns::ChooseMultiplierAndRound(uint64_t value) const
+{
+    if (!value) {
+        Rounded zero = { 0, 0, 0 };
+        return zero;
+    }
+    // same as icu, the multiplier is chosen again when rounding carries the number into the next magnitude.
+    int32_t magnitude = GetDigitCount(value) - 1;
+    int32_t multiplier = GetMultiplier(magnitude);
+    if (multiplier == INVALID_MULTIPLIER) {
+        Rounded invalid = { 0, 0, INVALID_MULTIPLIER };
+        return invalid;
+    }
+    Rounded rounded = Round(value, multiplier);
+    if (GetMagnitude(rounded) == magnitude + multiplier) {
+        return rounded;
+    }
+    int32_t nextMultiplier = GetMultiplier(magnitude + 1);
+    if (nextMultiplier == multiplier) {
+        return rounded;
+    }
+    if (nextMultiplier == INVALID_MULTIPLIER) {
+        Rounded invalid = { 0, 0, INVALID_MULTIPLIER };
+        return invalid;
+    }
+    return Round(value, nextMultiplier);
+}
+
+int32_t NotationPatterns::GetPluralClass(uint64_t digits, int32_t fractionDigits) const
+{
+    if (!fractionDigits && digits <= 1) {
+        return digits ? ONE_CLASS : ZERO_CLASS;
+    }
+    double number = static_cast<double>(digits) / static_cast<double>(POWERS_OF_TEN[fractionDigits]);
+    icu::UnicodeString keyword = pluralRules->select(number);
+    for (size_t i = 0; i < keywords.size(); ++i) {
+        if (keywords[i] == keyword) {
+            return KEYWORD_CLASS_BASE + static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void NotationPatterns::AppendDecimal(uint64_t digits, int32_t fractionDigits, icu::UnicodeString &result) const
+{
+    int32_t count = GetDigitCount(digits);
+    if (count <= fractionDigits) {
+        count = fractionDigits + 1;
+    }
+    for (int32_t i = count - 1; i >= 0; --i) {
+        if (i == fractionDigits - 1) {
+            result += decimalSeparator;
+        }
+        result += digitSymbols[(digits / POWERS_OF_TEN[i]) % 10]; // 10 selects the decimal digit
+    }
+}
+
+bool NotationPatterns::FormatCompact(uint64_t value, bool negative, icu::UnicodeString &result) const
+{
+    Rounded rounded = ChooseMultiplierAndRound(value);
+    if (rounded.multiplier == INVALID_MULTIPLIER) {
+        return false;
+    }
+    int32_t magnitude = rounded.digits ? (GetMagnitude(rounded) - rounded.multiplier) : 0;
+    if (magnitude < 0 || magnitude > MAX_MAGNITUDE || multipliers[magnitude] != rounded.multiplier ||
+        rounded.digits / POWERS_OF_TEN[rounded.fractionDigits] >= MAX_COMPACT_INTEGER) {
+        return false;
+    }
+    int32_t pluralClass = uniformClasses[magnitude];
+    if (pluralClass < 0) {
+        pluralClass = GetPluralClass(rounded.digits, rounded.fractionDigits);
+        if (pluralClass < 0) {
+            return false;
+        }
+    }
+    const Affixes &affixes = compactAffixes[magnitude * (KEYWORD_CLASS_BASE + keywords.size()) + pluralClass];
+    if (!affixes.valid) {
+        return false;
+    }
+    result.remove();
+    result += negative ? affixes.negativePrefix : affixes.prefix;
+    AppendDecimal(rounded.digits, rounded.fractionDigits, result);
+    result += negative ? affixes.negativeSuffix : affixes.suffix;
+    return true;
+}
+
+bool NotationPatterns::FormatScientific(uint64_t value, bool negative, icu::UnicodeString &result) const
+{
+    Rounded rounded = ChooseMultiplierAndRound(value);
+    if (rounded.multiplier > 0) {
+        return false;
+    }
+    const Affixes &affixes = plainAffixes;
+    result.remove();
+    result += negative ? affixes.negativePrefix : affixes.prefix;
+    AppendDecimal(rounded.digits, rounded.fractionDigits, result);
+    result += exponentSymbol;
+    AppendDecimal(static_cast<uint64_t>(-rounded.multiplier), 0, result);
+    result += negative ? affixes.negativeSuffix : affixes.suffix;
+    return true;
+}
+
+bool NotationPatterns::FormatStandard(uint64_t value, bool negative, icu::UnicodeString &result) const
+{
+    int32_t count = GetDigitCount(value);
+    uint32_t mask = groupingMasks[count - 1];
+    if (mask == INVALID_GROUPING) {
+        return false;
+    }
+    // the digits are assembled in a local buffer and copied into result at once.
+    char16_t buffer[MAX_STANDARD_LENGTH];
+    int32_t length = 0;
+    for (int32_t i = count - 1; i >= 0; --i) {
+        const icu::UnicodeString &digit = digitSymbols[(value / POWERS_OF_TEN[i]) % 10]; // 10 selects the digit
+        if (!AppendToBuffer(digit, buffer, length) ||
+            ((mask & (1U << i)) && !AppendToBuffer(groupingSeparator, buffer, length))) {
+            return false;
+        }
+    }
+    const Affixes &affixes = plainAffixes;
+    result = negative ? affixes.negativePrefix : affixes.prefix;
+    result.append(buffer, 0, length);
+    result += negative ? affixes.negativeSuffix : affixes.suffix;
+    return true;
+}
+
+bool NotationPatterns::Format(double number, icu::UnicodeString &result) const
+{
+    // only integral numbers are handled, negative zero keeps its sign in icu and is left to it as well.
+    if (!valid || !(number > -MAX_VALUE && number < MAX_VALUE) || number != std::floor(number) ||
+        (number == 0 && std::signbit(number))) {
+        return false;
+    }
+    bool negative = number < 0;
+    uint64_t value = static_cast<uint64_t>(negative ? -number : number);
+    if (type == STANDARD) {
+        return FormatStandard(value, negative, result);
+    } else if (type == SCIENTIFIC || type == ENGINEERING) {
+        return FormatScientific(value, negative, result);
+    }
+    return FormatCompact(value, negative, result);
+}
+} // namespace I18n
+} // namespace Global
+} // namespace OHOS
@@ -13,41 +13,58 @@
  * limitations under the License.
  */
 #include "number_format.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <locale>
 #include <codecvt>
-#include "ohos/init_data.h"
+#include "icu_data.h"
 #include "locale_config.h"
 
 namespace OHOS {
 namespace Global {
 namespace I18n {
-bool NumberFormat::icuInitialized = NumberFormat::Init();
+// keyword tables of NumberFormatOptions, indexed by the option enums. The empty keyword stands for *_UNSET.
+const char *STYLE_KEYWORDS[] = { "", "decimal", "percent", "currency", "unit" };
+const char *CURRENCY_SIGN_KEYWORDS[] = { "", "standard", "accounting" };
+const char *CURRENCY_DISPLAY_KEYWORDS[] = { "", "symbol", "code", "name", "narrowSymbol" };
+const char *UNIT_DISPLAY_KEYWORDS[] = { "", "short", "long", "narrow" };
+const char *SIGN_DISPLAY_KEYWORDS[] = { "", "auto", "never", "always", "exceptZero" };
+const char *NOTATION_KEYWORDS[] = { "", "standard", "scientific", "engineering", "compact" };
+const char *COMPACT_DISPLAY_KEYWORDS[] = { "", "short", "long" };
+const char *LOCALE_MATCHER_KEYWORDS[] = { "", "lookup", "best fit" };
+const char *USE_GROUPING_KEYWORDS[] = { "", "true", "false" };
 
-std::unordered_map<std::string, UNumberUnitWidth> NumberFormat::unitStyle = {
-    { "long", UNumberUnitWidth::UNUM_UNIT_WIDTH_FULL_NAME },
-    { "short", UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT },
-    { "narrow", UNumberUnitWidth::UNUM_UNIT_WIDTH_NARROW }
+const UNumberUnitWidth CURRENCY_WIDTHS[] = {
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_ISO_CODE,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_FULL_NAME,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_NARROW
 };
 
-std::unordered_map<std::string, UNumberUnitWidth> NumberFormat::currencyStyle = {
-    { "symbol", UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT },
-    { "code", UNumberUnitWidth::UNUM_UNIT_WIDTH_ISO_CODE },
-    { "name", UNumberUnitWidth::UNUM_UNIT_WIDTH_FULL_NAME },
-    { "narrowSymbol", UNumberUnitWidth::UNUM_UNIT_WIDTH_NARROW }
+const UNumberUnitWidth UNIT_WIDTHS[] = {
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_FULL_NAME,
+    UNumberUnitWidth::UNUM_UNIT_WIDTH_NARROW
 };
 
-std::unordered_map<std::string, UNumberSignDisplay> NumberFormat::signAutoStyle = {
-    { "auto", UNumberSignDisplay::UNUM_SIGN_AUTO },
-    { "never", UNumberSignDisplay::UNUM_SIGN_NEVER },
-    { "always", UNumberSignDisplay::UNUM_SIGN_ALWAYS },
-    { "exceptZero", UNumberSignDisplay::UNUM_SIGN_EXCEPT_ZERO }
+const UNumberSignDisplay SIGN_AUTO_STYLES[] = {
+    UNumberSignDisplay::UNUM_SIGN_AUTO,
+    UNumberSignDisplay::UNUM_SIGN_AUTO,
+    UNumberSignDisplay::UNUM_SIGN_NEVER,
+    UNumberSignDisplay::UNUM_SIGN_ALWAYS,
+    UNumberSignDisplay::UNUM_SIGN_EXCEPT_ZERO
 };
 
-std::unordered_map<std::string, UNumberSignDisplay> NumberFormat::signAccountingStyle = {
-    { "auto", UNumberSignDisplay::UNUM_SIGN_ACCOUNTING },
-    { "never", UNumberSignDisplay::UNUM_SIGN_NEVER },
-    { "always", UNumberSignDisplay::UNUM_SIGN_ACCOUNTING_ALWAYS },
-    { "exceptZero", UNumberSignDisplay::UNUM_SIGN_ACCOUNTING_EXCEPT_ZERO }
+const UNumberSignDisplay SIGN_ACCOUNTING_STYLES[] = {
+    UNumberSignDisplay::UNUM_SIGN_ACCOUNTING,
+    UNumberSignDisplay::UNUM_SIGN_ACCOUNTING,
+    UNumberSignDisplay::UNUM_SIGN_NEVER,
+    UNumberSignDisplay::UNUM_SIGN_ACCOUNTING_ALWAYS,
+    UNumberSignDisplay::UNUM_SIGN_ACCOUNTING_EXCEPT_ZERO
 };
 
 std::unordered_map<UMeasurementSystem, std::string> NumberFormat::measurementSystem = {
@@ -56,266 +73,588 @@ std::unordered_map<UMeasurementSystem, std::string> NumberFormat::measurementSys
     { UMeasurementSystem::UMS_UK, "UK" },
 };
 
+const size_t FORMATTER_CACHE_SIZE = 128;
+
+uint8_t ParseKeyword(const std::string &value, const char * const *keywords, size_t count)
+{
+    for (size_t i = 1; i < count; ++i) {
+        if (value == keywords[i]) {
+            return static_cast<uint8_t>(i);
+        }
+    }
+    return 0;
+}
+
+bool NumberFormatOptions::SetOption(const char *name, const std::string &value)
+{
+    if (!strcmp(name, "style")) {
+        style = static_cast<Style>(ParseKeyword(value, STYLE_KEYWORDS, sizeof(STYLE_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "currency")) {
+        currency = value;
+    } else if (!strcmp(name, "currencySign")) {
+        currencySign = static_cast<CurrencySign>(ParseKeyword(value, CURRENCY_SIGN_KEYWORDS,
+            sizeof(CURRENCY_SIGN_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "currencyDisplay")) {
+        currencyDisplay = static_cast<CurrencyDisplay>(ParseKeyword(value, CURRENCY_DISPLAY_KEYWORDS,
+            sizeof(CURRENCY_DISPLAY_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "unit")) {
+        unit = value;
+    } else if (!strcmp(name, "unitDisplay")) {
+        unitDisplay = static_cast<UnitDisplay>(ParseKeyword(value, UNIT_DISPLAY_KEYWORDS,
+            sizeof(UNIT_DISPLAY_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "unitUsage")) {
+        unitUsage = value;
+    } else if (!strcmp(name, "signDisplay")) {
+        signDisplay = static_cast<SignDisplay>(ParseKeyword(value, SIGN_DISPLAY_KEYWORDS,
+            sizeof(SIGN_DISPLAY_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "notation")) {
+        notation = static_cast<Notation>(ParseKeyword(value, NOTATION_KEYWORDS,
+            sizeof(NOTATION_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "compactDisplay")) {
+        // every compactDisplay other than long falls back to the short form.
+        compactDisplay = (value == "long") ? COMPACT_DISPLAY_LONG : COMPACT_DISPLAY_SHORT;
+    } else if (!strcmp(name, "localeMatcher")) {
+        localeMatcher = static_cast<LocaleMatcher>(ParseKeyword(value, LOCALE_MATCHER_KEYWORDS,
+            sizeof(LOCALE_MATCHER_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "useGrouping")) {
+        useGrouping = static_cast<UseGrouping>(ParseKeyword(value, USE_GROUPING_KEYWORDS,
+            sizeof(USE_GROUPING_KEYWORDS) / sizeof(char *)));
+    } else if (!strcmp(name, "numberingSystem")) {
+        numberingSystem = value;
+    } else {
+        const char *begin = value.c_str();
+        char *end = nullptr;
+        long digits = strtol(begin, &end, 10);
+        return end != begin && digits >= 0 && digits <= INT32_MAX &&
+            SetDigitsOption(name, static_cast<int32_t>(digits));
+    }
+    return true;
+}
+
+bool NumberFormatOptions::SetDigitsOption(const char *name, int32_t value)
+{
+    if (value < 0) {
+        return false;
+    }
+    if (!strcmp(name, "minimumIntegerDigits")) {
+        minimumIntegerDigits = value;
+    } else if (!strcmp(name, "minimumFractionDigits")) {
+        minimumFractionDigits = value;
+    } else if (!strcmp(name, "maximumFractionDigits")) {
+        maximumFractionDigits = value;
+    } else if (!strcmp(name, "minimumSignificantDigits")) {
+        minimumSignificantDigits = value;
+    } else if (!strcmp(name, "maximumSignificantDigits")) {
+        maximumSignificantDigits = value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+NumberFormat::NumberFormat(const std::vector<std::string> &localeTags, const NumberFormatOptions &formatOptions)
+    : options(formatOptions)
+{
+    // numberingSystem is the only option taking part in the locale.
+    std::map<std::string, std::string> localeConfigs;
+    if (!formatOptions.numberingSystem.empty()) {
+        localeConfigs.insert(std::make_pair("numberingSystem", formatOptions.numberingSystem));
+    }
+    Init(localeTags, localeConfigs);
+}
+
 NumberFormat::NumberFormat(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &configs)
 {
+    for (const auto &config : configs) {
+        options.SetOption(config.first.c_str(), config.second);
+    }
+    Init(localeTags, configs);
+}
+
+void NumberFormat::Init(const std::vector<std::string> &localeTags, std::map<std::string, std::string> &localeConfigs)
+{
+    InitIcuData();
+    ResolveOptions();
+    std::string cacheKey = ComputeCacheKey(localeTags, localeConfigs);
+    CachedFormatter cached;
+    if (GetFormatterCache().Get(cacheKey, cached)) {
+        localeInfo = cached.localeInfo;
+        locale = localeInfo->GetLocale();
+        localeBaseName = localeInfo->GetBaseName();
+        numberFormat = cached.numberFormat;
+        unitFactors = cached.unitFactors;
+        preferredUnits = cached.preferredUnits;
+        notationPatterns = cached.notationPatterns;
+        mixedUnitFormat = cached.mixedUnitFormat;
+        return;
+    }
     UErrorCode status = U_ZERO_ERROR;
-    std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
-    builder = std::make_unique<icu::LocaleBuilder>();
-    ParseConfigs(configs);
+    icu::LocaleBuilder builder;
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
-        locale = builder->setLanguageTag(icu::StringPiece(curLocale)).build(status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
-            localeInfo = new LocaleInfo(curLocale, configs);
-            locale = localeInfo->GetLocale();
-            localeBaseName = localeInfo->GetBaseName();
-            numberFormat = icu::number::NumberFormatter::withLocale(locale);
-            icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, status);
+        locale = builder.setLanguageTag(icu::StringPiece(curLocale)).build(status);
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
+            localeInfo = LocaleRegistry::Acquire(curLocale, localeConfigs);
             break;
         }
     }
     if (!localeInfo) {
-        localeInfo = new LocaleInfo(LocaleConfig::GetSystemLocale(), configs);
-        locale = localeInfo->GetLocale();
-        localeBaseName = localeInfo->GetBaseName();
-        numberFormat = icu::number::NumberFormatter::withLocale(locale);
-        icu::MeasureUnit::getAvailable(unitArray, MAX_UNIT_NUM, status);
+        localeInfo = LocaleRegistry::Acquire(LocaleConfig::GetSystemLocale(), localeConfigs);
+    }
+    locale = localeInfo->GetLocale();
+    localeBaseName = localeInfo->GetBaseName();
+    icu::number::LocalizedNumberFormatter formatter = icu::number::NumberFormatter::withLocale(locale);
+    InitProperties(formatter);
+    numberFormat = std::make_shared<const icu::number::LocalizedNumberFormatter>(formatter);
+    InitPreferredUnits();
+    InitNotationPatterns();
+    cached = { localeInfo, numberFormat, unitFactors, preferredUnits, notationPatterns, mixedUnitFormat };
+    GetFormatterCache().Put(cacheKey, cached);
+}
+
+void NumberFormat::ResolveOptions()
+{
+    // the unit and currency options only apply to their own style.
+    if (options.style != NumberFormatOptions::STYLE_UNIT || options.unit.empty()) {
+        options.unit.clear();
+        options.unitDisplay = NumberFormatOptions::UNIT_DISPLAY_UNSET;
+        options.unitUsage.clear();
+    }
+    if (options.style != NumberFormatOptions::STYLE_CURRENCY || options.currency.empty()) {
+        options.currency.clear();
+        options.currencySign = NumberFormatOptions::CURRENCY_SIGN_UNSET;
+        options.currencyDisplay = NumberFormatOptions::CURRENCY_DISPLAY_UNSET;
+    }
+    if (options.notation != NumberFormatOptions::NOTATION_COMPACT) {
+        options.compactDisplay = NumberFormatOptions::COMPACT_DISPLAY_UNSET;
     }
-    InitProperties();
 }
 
 NumberFormat::~NumberFormat()
 {
-    if (localeInfo != nullptr) {
-        delete localeInfo;
-        localeInfo = nullptr;
-    }
 }
 
-void NumberFormat::InitProperties()
+LruCache<std::string, NumberFormat::CachedFormatter> &NumberFormat::GetFormatterCache()
+{
+    static LruCache<std::string, CachedFormatter> cache(FORMATTER_CACHE_SIZE);
+    return cache;
+}
+
+std::string NumberFormat::ComputeCacheKey(const std::vector<std::string> &localeTags,
+    const std::map<std::string, std::string> &localeConfigs) const
+{
+    // the system locale is the fallback when none of the tags is valid, so it is part of the key as well.
+    std::string key = LocaleConfig::GetSystemLocale();
+    for (const std::string &localeTag : localeTags) {
+        key.append(1, '\0').append(localeTag);
+    }
+    key.append(1, '\1');
+    for (const auto &config : localeConfigs) {
+        key.append(config.first).append(1, '=').append(config.second).append(1, '\0');
+    }
+    const uint8_t keywords[] = { options.style, options.currencySign, options.currencyDisplay, options.unitDisplay,
+        options.signDisplay, options.notation, options.compactDisplay, options.useGrouping };
+    key.append(reinterpret_cast<const char *>(keywords), sizeof(keywords));
+    const int32_t digits[] = { options.minimumIntegerDigits, options.minimumFractionDigits,
+        options.maximumFractionDigits, options.minimumSignificantDigits, options.maximumSignificantDigits };
+    key.append(reinterpret_cast<const char *>(digits), sizeof(digits));
+    key.append(options.currency).append(1, '\0').append(options.unit).append(1, '\0').append(options.unitUsage);
+    return key;
+}
+
+void NumberFormat::GetFormatterCacheStats(uint64_t &hits, uint64_t &misses)
+{
+    hits = GetFormatterCache().GetHits();
+    misses = GetFormatterCache().GetMisses();
+}
+
+void NumberFormat::InitProperties(icu::number::LocalizedNumberFormatter &formatter)
 {
-    if (!currency.empty()) {
+    if (!options.currency.empty()) {
         UErrorCode status = U_ZERO_ERROR;
-        numberFormat =
-            numberFormat.unit(icu::CurrencyUnit(icu::UnicodeString(currency.c_str()).getBuffer(), status));
+        formatter =
+            formatter.unit(icu::CurrencyUnit(icu::UnicodeString(options.currency.c_str()).getBuffer(), status));
+        UNumberUnitWidth currencyDisplay = CURRENCY_WIDTHS[options.currencyDisplay];
         if (currencyDisplay != UNumberUnitWidth::UNUM_UNIT_WIDTH_SHORT) {
-            numberFormat = numberFormat.unitWidth(currencyDisplay);
+            formatter = formatter.unitWidth(currencyDisplay);
         }
     }
-    if (!styleString.empty() && styleString == "percent") {
-        numberFormat = numberFormat.unit(icu::NoUnit::percent());
+    if (options.style == NumberFormatOptions::STYLE_PERCENT) {
+        formatter = formatter.unit(icu::NoUnit::percent());
     }
-    if (!styleString.empty() && styleString == "unit") {
-        for (icu::MeasureUnit curUnit : unitArray) {
-            if (!strcmp(curUnit.getSubtype(), unit.c_str())) {
-                numberFormat = numberFormat.unit(curUnit);
-                unitType = curUnit.getType();
-            }
+    if (options.style == NumberFormatOptions::STYLE_UNIT) {
+        const icu::MeasureUnit *measureUnit = FindMeasureUnit(options.unit);
+        if (measureUnit != nullptr) {
+            formatter = formatter.unit(*measureUnit);
+            unitType = measureUnit->getType();
         }
         UErrorCode status = U_ZERO_ERROR;
         UMeasurementSystem measSys = ulocdata_getMeasurementSystem(localeBaseName.c_str(), &status);
         if (status == U_ZERO_ERROR && measSys >= 0) {
             unitMeasSys = measurementSystem[measSys];
         }
-        numberFormat = numberFormat.unitWidth(unitDisplay);
-        numberFormat = numberFormat.precision(icu::number::Precision::maxFraction(DEFAULT_FRACTION_DIGITS));
+        formatter = formatter.unitWidth(UNIT_WIDTHS[options.unitDisplay]);
+        formatter = formatter.precision(icu::number::Precision::maxFraction(DEFAULT_FRACTION_DIGITS));
     }
-    if (!useGrouping.empty()) {
-        numberFormat.grouping((useGrouping == "true") ?
+    if (options.useGrouping != NumberFormatOptions::USE_GROUPING_UNSET) {
+        formatter.grouping((options.useGrouping == NumberFormatOptions::USE_GROUPING_TRUE) ?
             UNumberGroupingStrategy::UNUM_GROUPING_AUTO : UNumberGroupingStrategy::UNUM_GROUPING_OFF);
     }
-    if (!currencySign.empty() || !signDisplayString.empty()) {
-        numberFormat = numberFormat.sign(signDisplay);
+    if (options.currencySign != NumberFormatOptions::CURRENCY_SIGN_UNSET ||
+        options.signDisplay != NumberFormatOptions::SIGN_DISPLAY_UNSET) {
+        formatter = formatter.sign(GetSignDisplay());
     }
-    if (!notationString.empty()) {
-        numberFormat = numberFormat.notation(notation);
+    if (options.notation != NumberFormatOptions::NOTATION_UNSET) {
+        formatter = formatter.notation(GetNotation());
+    }
+    InitDigitsProperties(formatter);
+}
+
+UNumberSignDisplay NumberFormat::GetSignDisplay() const
+{
+    if (options.currencySign != NumberFormatOptions::CURRENCY_SIGN_UNSET &&
+        options.currencySign != NumberFormatOptions::CURRENCY_SIGN_ACCOUNTING &&
+        options.signDisplay != NumberFormatOptions::SIGN_DISPLAY_UNSET) {
+        return SIGN_ACCOUNTING_STYLES[options.signDisplay];
     }
-    InitDigitsProperties();
+    return SIGN_AUTO_STYLES[options.signDisplay];
 }
 
-void NumberFormat::InitDigitsProperties()
+icu::number::Notation NumberFormat::GetNotation() const
 {
-    if (!maximumSignificantDigits.empty() || !minimumSignificantDigits.empty()) {
-        if (!maximumSignificantDigits.empty()) {
-            int32_t maxSignificantDigits = std::stoi(maximumSignificantDigits);
-            numberFormat = numberFormat.precision(icu::number::Precision::maxSignificantDigits(maxSignificantDigits));
+    switch (options.notation) {
+        case NumberFormatOptions::NOTATION_SCIENTIFIC:
+            return icu::number::Notation::scientific();
+        case NumberFormatOptions::NOTATION_ENGINEERING:
+            return icu::number::Notation::engineering();
+        case NumberFormatOptions::NOTATION_COMPACT:
+            if (options.compactDisplay == NumberFormatOptions::COMPACT_DISPLAY_LONG) {
+                return icu::number::Notation::compactLong();
+            } else if (options.compactDisplay == NumberFormatOptions::COMPACT_DISPLAY_SHORT) {
+                return icu::number::Notation::compactShort();
+            }
+            return icu::number::Notation::simple();
+        default:
+            return icu::number::Notation::simple();
+    }
+}
+
+void NumberFormat::InitDigitsProperties(icu::number::LocalizedNumberFormatter &formatter)
+{
+    if (options.maximumSignificantDigits != NumberFormatOptions::UNSET_DIGITS ||
+        options.minimumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+        if (options.maximumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+            formatter = formatter.precision(
+                icu::number::Precision::maxSignificantDigits(options.maximumSignificantDigits));
         }
-        if (!minimumSignificantDigits.empty()) {
-            int32_t minSignificantDigits = std::stoi(minimumSignificantDigits);
-            numberFormat = numberFormat.precision(icu::number::Precision::minSignificantDigits(minSignificantDigits));
+        if (options.minimumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+            formatter = formatter.precision(
+                icu::number::Precision::minSignificantDigits(options.minimumSignificantDigits));
         }
     } else {
-        if (!minimumIntegerDigits.empty() && std::stoi(minimumIntegerDigits) > 1) {
-            numberFormat =
-                numberFormat.integerWidth(icu::number::IntegerWidth::zeroFillTo(std::stoi(minimumIntegerDigits)));
+        if (options.minimumIntegerDigits > 1) {
+            formatter = formatter.integerWidth(icu::number::IntegerWidth::zeroFillTo(options.minimumIntegerDigits));
         }
-        if (!minimumFractionDigits.empty()) {
-            numberFormat =
-                numberFormat.precision(icu::number::Precision::minFraction(std::stoi(minimumFractionDigits)));
+        if (options.minimumFractionDigits != NumberFormatOptions::UNSET_DIGITS) {
+            formatter = formatter.precision(icu::number::Precision::minFraction(options.minimumFractionDigits));
         }
-        if (!maximumFractionDigits.empty()) {
-            numberFormat =
-                numberFormat.precision(icu::number::Precision::maxFraction(std::stoi(maximumFractionDigits)));
+        if (options.maximumFractionDigits != NumberFormatOptions::UNSET_DIGITS) {
+            formatter = formatter.precision(icu::number::Precision::maxFraction(options.maximumFractionDigits));
         }
     }
 }
 
-void NumberFormat::ParseConfigs(std::map<std::string, std::string> &configs)
+// the increment of the preference of unit, 0 when it has none.
+double GetPreferenceIncrement(const UnitPreferences &preferences, const std::string &unit)
 {
-    if (configs.count("signDisplay") > 0) {
-        signDisplayString = configs["signDisplay"];
-        if (signAutoStyle.count(signDisplayString) > 0) {
-            signDisplay = signAutoStyle[signDisplayString];
+    for (size_t i = 0; i < preferences.count; ++i) {
+        if (unit == preferences.units[i].unit) {
+            return preferences.units[i].increment;
         }
     }
-    if (configs.count("style") > 0) {
-        styleString = configs["style"];
-    }
-    if (styleString == "unit" && configs.count("unit") > 0) {
-        unit = configs["unit"];
-        if (configs.count("unitDisplay") > 0) {
-            unitDisplayString = configs["unitDisplay"];
-            unitDisplay = unitStyle[unitDisplayString];
-        }
-        if (configs.count("unitUsage") > 0) {
-            unitUsage = configs["unitUsage"];
+    return 0;
+}
+
+void NumberFormat::InitPreferredUnits()
+{
+    if (options.unitUsage.empty()) {
+        return;
+    }
+    const icu::MeasureUnit *measureUnit = FindMeasureUnit(options.unit);
+    std::vector<double> factors = { 0.0, 0.0 };
+    if (measureUnit == nullptr || !ComputeValue(options.unit, unitMeasSys, factors)) {
+        return;
+    }
+    std::string usage = (options.unitUsage == "default") ? (unitType + "-default") : options.unitUsage;
+    UnitPreferences preferences = GetUnitPreferences(localeInfo->GetRegion(), usage);
+    // like icu, the rounding of the preferences applies unless digit options are given.
+    bool cldrPrecision = options.minimumFractionDigits == NumberFormatOptions::UNSET_DIGITS &&
+        options.maximumFractionDigits == NumberFormatOptions::UNSET_DIGITS &&
+        options.minimumSignificantDigits == NumberFormatOptions::UNSET_DIGITS &&
+        options.maximumSignificantDigits == NumberFormatOptions::UNSET_DIGITS;
+    mixedUnitFormat = MixedUnitFormat::Create(locale, preferences, options.unit, unitMeasSys, *numberFormat,
+        UNIT_WIDTHS[options.unitDisplay], cldrPrecision);
+    std::vector<std::string> units;
+    for (size_t i = 0; i < preferences.count; ++i) {
+        // mixed units like foot-and-inch are offered as the units they are made of.
+        std::vector<std::string> singles;
+        SplitMixedUnit(preferences.units[i].unit, singles);
+        for (const std::string &single : singles) {
+            if (std::find(units.begin(), units.end(), single) == units.end()) {
+                units.push_back(single);
+            }
         }
     }
-    if (styleString == "currency" && configs.count("currency") > 0) {
-        currency = configs["currency"];
-        if (configs.count("currencySign") > 0) {
-            currencySign = configs["currencySign"];
-            if (configs["currencySign"] != "accounting" && !signDisplayString.empty()) {
-                signDisplay = signAccountingStyle[signDisplayString];
-            }
+    for (const std::string &preferred : units) {
+        const icu::MeasureUnit *preferredUnit = FindMeasureUnit(preferred);
+        std::vector<double> preferredFactors = { 0.0, 0.0 };
+        if (preferredUnit == nullptr || strcmp(preferredUnit->getType(), measureUnit->getType()) ||
+            !ComputeValue(preferred, unitMeasSys, preferredFactors)) {
+            continue;
         }
-        if (configs.count("currencyDisplay") > 0 && currencyStyle.count(configs["currencyDisplay"]) > 0) {
-            currencyDisplayString = configs["currencyDisplay"];
-            currencyDisplay = currencyStyle[currencyDisplayString];
+        icu::number::LocalizedNumberFormatter unitFormat = numberFormat->unit(*preferredUnit);
+        if (cldrPrecision) {
+            unitFormat = unitFormat.precision(
+                MixedUnitFormat::GetCldrPrecision(GetPreferenceIncrement(preferences, preferred)));
         }
+        PreferredUnit candidate = { preferredFactors[0], preferredFactors[1],
+            std::make_shared<const icu::number::LocalizedNumberFormatter>(unitFormat) };
+        preferredUnits.push_back(candidate);
     }
-    ParseDigitsConfigs(configs);
+    unitFactors = factors;
 }
 
-void NumberFormat::ParseDigitsConfigs(std::map<std::string, std::string> &configs)
+std::string NumberFormat::Format(double number) const
 {
-    if (configs.count("notation") > 0) {
-        notationString = configs["notation"];
-        if (notationString == "scientific") {
-            notation = icu::number::Notation::scientific();
-        } else if (notationString == "engineering") {
-            notation = icu::number::Notation::engineering();
-        }
-        if (notationString == "compact" && configs.count("compactDisplay") > 0) {
-            compactDisplay = configs["compactDisplay"];
-            if (compactDisplay == "long") {
-                notation = icu::number::Notation::compactLong();
-            } else {
-                notation = icu::number::Notation::compactShort();
-            }
-        }
-    }
-    if (configs.count("minimumIntegerDigits") > 0) {
-        minimumIntegerDigits = configs["minimumIntegerDigits"];
-    }
-    if (configs.count("minimumFractionDigits") > 0) {
-        minimumFractionDigits = configs["minimumFractionDigits"];
-    }
-    if (configs.count("maximumFractionDigits") > 0) {
-        maximumFractionDigits = configs["maximumFractionDigits"];
-    }
-    if (configs.count("minimumSignificantDigits") > 0) {
-        minimumSignificantDigits = configs["minimumSignificantDigits"];
-    }
-    if (configs.count("maximumSignificantDigits") > 0) {
-        maximumSignificantDigits = configs["maximumSignificantDigits"];
-    }
-    if (configs.count("numberingSystem") > 0) {
-        numberingSystem = configs["numberingSystem"];
+    std::string result;
+    icu::UnicodeString formatted;
+    Format(number, formatted);
+    formatted.toUTF8String(result);
+    return result;
+}
+
+void NumberFormat::Format(double number, icu::UnicodeString &result) const
+{
+    if (mixedUnitFormat != nullptr && mixedUnitFormat->Format(number, result)) {
+        return;
     }
-    if (configs.count("useGrouping") > 0) {
-        useGrouping = configs["useGrouping"];
+    if (notationPatterns != nullptr && notationPatterns->Format(number, result)) {
+        return;
     }
-    if (configs.count("localeMatcher") > 0) {
-        localeMatcher = configs["localeMatcher"];
+    UErrorCode status = U_ZERO_ERROR;
+    result = FormatToValue(number, status).toString(status);
+}
+
+void NumberFormat::InitNotationPatterns()
+{
+    // the patterns reproduce the plain notation only, without units, sign display or digit options.
+    if ((options.style != NumberFormatOptions::STYLE_UNSET && options.style != NumberFormatOptions::STYLE_DECIMAL) ||
+        !preferredUnits.empty() || options.currencySign != NumberFormatOptions::CURRENCY_SIGN_UNSET ||
+        options.signDisplay != NumberFormatOptions::SIGN_DISPLAY_UNSET ||
+        options.minimumIntegerDigits != NumberFormatOptions::UNSET_DIGITS ||
+        options.minimumFractionDigits != NumberFormatOptions::UNSET_DIGITS ||
+        options.maximumFractionDigits != NumberFormatOptions::UNSET_DIGITS ||
+        options.minimumSignificantDigits != NumberFormatOptions::UNSET_DIGITS ||
+        options.maximumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+        return;
+    }
+    if (options.notation == NumberFormatOptions::NOTATION_SCIENTIFIC) {
+        notationPatterns = NotationPatterns::Acquire(locale, NotationPatterns::SCIENTIFIC);
+    } else if (options.notation == NumberFormatOptions::NOTATION_ENGINEERING) {
+        notationPatterns = NotationPatterns::Acquire(locale, NotationPatterns::ENGINEERING);
+    } else if (options.notation == NumberFormatOptions::NOTATION_COMPACT &&
+        options.compactDisplay == NumberFormatOptions::COMPACT_DISPLAY_LONG) {
+        notationPatterns = NotationPatterns::Acquire(locale, NotationPatterns::COMPACT_LONG);
+    } else if (options.notation == NumberFormatOptions::NOTATION_COMPACT &&
+        options.compactDisplay == NumberFormatOptions::COMPACT_DISPLAY_SHORT) {
+        notationPatterns = NotationPatterns::Acquire(locale, NotationPatterns::COMPACT_SHORT);
+    } else {
+        // compact notation without compactDisplay is formatted as standard, see GetNotation.
+        notationPatterns = NotationPatterns::Acquire(locale, NotationPatterns::STANDARD);
     }
 }
 
-std::string NumberFormat::Format(double number)
+icu::number::FormattedNumber NumberFormat::FormatToValue(double number, UErrorCode &status) const
 {
+    const icu::number::LocalizedNumberFormatter *formatter = numberFormat.get();
     double finalNumber = number;
-    if (!unitUsage.empty()) {
-        std::vector<std::string> preferredUnits;
-        if (unitUsage == "default") {
-            GetDefaultPreferredUnit(localeInfo->GetRegion(), unitType, preferredUnits);
-        } else {
-            GetPreferredUnit(localeInfo->GetRegion(), unitUsage, preferredUnits);
-        }
-        std::map<double, std::string> preferredValuesOverOne;
-        std::map<double, std::string> preferredValuesUnderOne;
-        double num = number;
-        for (size_t i = 0; i < preferredUnits.size(); i++) {
-            int status = Convert(num, unit, unitMeasSys, preferredUnits[i], unitMeasSys);
-            if (!status) {
-                continue;
-            }
-            if (num >= 1) {
-                preferredValuesOverOne.insert(std::make_pair(num, preferredUnits[i]));
-            } else {
-                preferredValuesUnderOne.insert(std::make_pair(num, preferredUnits[i]));
+    if (!preferredUnits.empty()) {
+        // the smallest magnitude not under one is preferred, otherwise the largest magnitude under one, so a
+        // negative value takes the unit of its absolute value like icu does.
+        double baseValue = unitFactors[0] * number + unitFactors[1];
+        const PreferredUnit *overOne = nullptr;
+        const PreferredUnit *underOne = nullptr;
+        double overOneValue = 0.0;
+        double underOneValue = 0.0;
+        for (const PreferredUnit &candidate : preferredUnits) {
+            double value = (baseValue - candidate.offset) / candidate.factor;
+            if (fabs(value) >= 1) {
+                if (overOne == nullptr || fabs(value) < fabs(overOneValue)) {
+                    overOne = &candidate;
+                    overOneValue = value;
+                }
+            } else if (underOne == nullptr || fabs(value) > fabs(underOneValue)) {
+                underOne = &candidate;
+                underOneValue = value;
             }
         }
-        std::string preferredUnit;
-        if (preferredValuesOverOne.size() > 0) {
-            finalNumber = preferredValuesOverOne.begin()->first;
-            preferredUnit = preferredValuesOverOne.begin()->second;
-        } else if (preferredValuesUnderOne.size() > 0) {
-            finalNumber = preferredValuesUnderOne.rbegin()->first;
-            preferredUnit = preferredValuesUnderOne.rbegin()->second;
+        if (overOne != nullptr) {
+            finalNumber = overOneValue;
+            formatter = overOne->numberFormat.get();
+        } else if (underOne != nullptr) {
+            finalNumber = underOneValue;
+            formatter = underOne->numberFormat.get();
         }
-        if (!preferredUnit.empty()) {
-            for (icu::MeasureUnit curUnit : unitArray) {
-                if (!strcmp(curUnit.getSubtype(), preferredUnit.c_str())) {
-                    numberFormat = numberFormat.unit(curUnit);
-                }
+    }
+    return formatter->formatDouble(finalNumber, status);
+}
+
+// nested fields such as the grouping separators override the integer span they split.
+void CollectNumberFields(const icu::FormattedValue &value, int32_t offset, std::vector<int32_t> &fields,
+    UErrorCode &status)
+{
+    icu::ConstrainedFieldPosition position;
+    position.constrainCategory(UFIELD_CATEGORY_NUMBER);
+    int32_t length = static_cast<int32_t>(fields.size());
+    while (value.nextPosition(position, status)) {
+        int32_t limit = std::min(position.getLimit() + offset, length);
+        for (int32_t i = position.getStart() + offset; i < limit; ++i) {
+            if (fields[i] == NumberFormat::LITERAL_FIELD || fields[i] == UNUM_INTEGER_FIELD) {
+                fields[i] = position.getField();
             }
         }
     }
-    std::string result;
+}
+
+void NumberFormat::FormatToParts(double number, icu::UnicodeString &formatted,
+    std::vector<NumberFormatPart> &parts) const
+{
+    parts.clear();
     UErrorCode status = U_ZERO_ERROR;
-    numberFormat.formatDouble(finalNumber, status).toString(status).toUTF8String(result);
-    return result;
+    std::vector<int32_t> fields;
+    icu::number::FormattedNumber items[MixedUnitFormat::MAX_COMPONENTS];
+    size_t count = 0;
+    icu::FormattedList list;
+    if (mixedUnitFormat != nullptr && mixedUnitFormat->FormatToValue(number, items, count, list)) {
+        // the fields of every unit are placed at the span of the unit in the list.
+        formatted = list.toString(status);
+        fields.assign(formatted.length(), LITERAL_FIELD);
+        icu::ConstrainedFieldPosition span;
+        span.constrainCategory(UFIELD_CATEGORY_LIST_SPAN);
+        while (U_SUCCESS(status) && list.nextPosition(span, status)) {
+            if (span.getField() >= 0 && static_cast<size_t>(span.getField()) < count) {
+                CollectNumberFields(items[span.getField()], span.getStart(), fields, status);
+            }
+        }
+    } else {
+        // notationPatterns reproduce the text of icu, whose fields are taken here.
+        icu::number::FormattedNumber value = FormatToValue(number, status);
+        formatted = value.toString(status);
+        fields.assign(formatted.length(), LITERAL_FIELD);
+        CollectNumberFields(value, 0, fields, status);
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t i = 0; i < formatted.length(); ++i) {
+        if (parts.empty() || parts.back().field != fields[i] || fields[i] == UNUM_GROUPING_SEPARATOR_FIELD) {
+            parts.push_back({ fields[i], i, i + 1 });
+        } else {
+            parts.back().end = i + 1;
+        }
+    }
+}
+
+const char *NumberFormat::GetPartType(const icu::UnicodeString &formatted, const NumberFormatPart &part)
+{
+    switch (part.field) {
+        case UNUM_INTEGER_FIELD:
+            return "integer";
+        case UNUM_FRACTION_FIELD:
+            return "fraction";
+        case UNUM_DECIMAL_SEPARATOR_FIELD:
+            return "decimal";
+        case UNUM_GROUPING_SEPARATOR_FIELD:
+            return "group";
+        case UNUM_EXPONENT_SYMBOL_FIELD:
+            return "exponentSeparator";
+        case UNUM_EXPONENT_SIGN_FIELD:
+            return "exponentMinusSign";
+        case UNUM_EXPONENT_FIELD:
+            return "exponentInteger";
+        case UNUM_SIGN_FIELD:
+            return (formatted.indexOf(u'+', part.begin, part.end - part.begin) >= 0) ? "plusSign" : "minusSign";
+        case UNUM_PERCENT_FIELD:
+            return "percentSign";
+        case UNUM_CURRENCY_FIELD:
+            return "currency";
+        case UNUM_MEASURE_UNIT_FIELD:
+            return "unit";
+        case UNUM_COMPACT_FIELD:
+            return "compact";
+        default:
+            return "literal";
+    }
+}
+
+void NumberFormat::FormatBatch(const double *numbers, size_t count, std::string &arena,
+    std::vector<size_t> &offsets) const
+{
+    arena.clear();
+    offsets.clear();
+    offsets.reserve(count + 1);
+    offsets.push_back(0);
+    if (numbers == nullptr) {
+        // every value is an empty string, so callers can still read count + 1 offsets.
+        offsets.resize(count + 1, 0);
+        return;
+    }
+    icu::UnicodeString pattern;
+    icu::number::FormattedNumber number;
+    for (size_t i = 0; i < count; ++i) {
+        if (!preferredUnits.empty()) {
+            arena.append(Format(numbers[i]));
+        } else if (notationPatterns != nullptr && notationPatterns->Format(numbers[i], pattern)) {
+            pattern.toUTF8String(arena);
+        } else {
+            // the temp string aliases the formatted result, it is appended to the arena without a copy.
+            UErrorCode status = U_ZERO_ERROR;
+            number = numberFormat->formatDouble(numbers[i], status);
+            number.toTempString(status).toUTF8String(arena);
+        }
+        offsets.push_back(arena.length());
+    }
 }
 
 void NumberFormat::GetResolvedOptions(std::map<std::string, std::string> &map)
 {
     map.insert(std::make_pair("locale", localeBaseName));
-    if (!styleString.empty()) {
-        map.insert(std::make_pair("style", styleString));
+    if (options.style != NumberFormatOptions::STYLE_UNSET) {
+        map.insert(std::make_pair("style", STYLE_KEYWORDS[options.style]));
     }
-    if (!currency.empty()) {
-        map.insert(std::make_pair("currency", currency));
+    if (!options.currency.empty()) {
+        map.insert(std::make_pair("currency", options.currency));
     }
-    if (!currencySign.empty()) {
-        map.insert(std::make_pair("currencySign", currencySign));
+    if (options.currencySign != NumberFormatOptions::CURRENCY_SIGN_UNSET) {
+        map.insert(std::make_pair("currencySign", CURRENCY_SIGN_KEYWORDS[options.currencySign]));
     }
-    if (!currencyDisplayString.empty()) {
-        map.insert(std::make_pair("currencyDisplay", currencyDisplayString));
+    if (options.currencyDisplay != NumberFormatOptions::CURRENCY_DISPLAY_UNSET) {
+        map.insert(std::make_pair("currencyDisplay", CURRENCY_DISPLAY_KEYWORDS[options.currencyDisplay]));
     }
-    if (!signDisplayString.empty()) {
-        map.insert(std::make_pair("signDisplay", signDisplayString));
+    if (options.signDisplay != NumberFormatOptions::SIGN_DISPLAY_UNSET) {
+        map.insert(std::make_pair("signDisplay", SIGN_DISPLAY_KEYWORDS[options.signDisplay]));
     }
-    if (!compactDisplay.empty()) {
-        map.insert(std::make_pair("compactDisplay", compactDisplay));
+    if (options.compactDisplay != NumberFormatOptions::COMPACT_DISPLAY_UNSET) {
+        map.insert(std::make_pair("compactDisplay", COMPACT_DISPLAY_KEYWORDS[options.compactDisplay]));
     }
-    if (!unitDisplayString.empty()) {
-        map.insert(std::make_pair("unitDisplay", unitDisplayString));
+    if (options.unitDisplay != NumberFormatOptions::UNIT_DISPLAY_UNSET) {
+        map.insert(std::make_pair("unitDisplay", UNIT_DISPLAY_KEYWORDS[options.unitDisplay]));
     }
-    if (!unitUsage.empty()) {
-        map.insert(std::make_pair("unitUsage", unitUsage));
+    if (!options.unitUsage.empty()) {
+        map.insert(std::make_pair("unitUsage", options.unitUsage));
     }
-    if (!unit.empty()) {
-        map.insert(std::make_pair("unit", unit));
+    if (!options.unit.empty()) {
+        map.insert(std::make_pair("unit", options.unit));
     }
     GetDigitsResolvedOptions(map);
 }
@@ -323,99 +662,98 @@ void NumberFormat::GetResolvedOptions(std::map<std::string, std::string> &map)
 void NumberFormat::GetDigitsResolvedOptions(std::map<std::string, std::string> &map)
 {
     UErrorCode status = U_ZERO_ERROR;
-    if (!numberingSystem.empty()) {
-        map.insert(std::make_pair("numberingSystem", numberingSystem));
+    if (!options.numberingSystem.empty()) {
+        map.insert(std::make_pair("numberingSystem", options.numberingSystem));
     } else if (!(localeInfo->GetNumberingSystem()).empty()) {
         map.insert(std::make_pair("numberingSystem", localeInfo->GetNumberingSystem()));
     } else {
         auto numSys = std::unique_ptr<icu::NumberingSystem>(icu::NumberingSystem::createInstance(locale, status));
         map.insert(std::make_pair("numberingSystem", numSys->getName()));
     }
-    if (!useGrouping.empty()) {
-        map.insert(std::make_pair("useGrouping", useGrouping));
+    if (options.useGrouping != NumberFormatOptions::USE_GROUPING_UNSET) {
+        map.insert(std::make_pair("useGrouping", GetUseGrouping()));
     }
-    if (!minimumIntegerDigits.empty()) {
-        map.insert(std::make_pair("minimumIntegerDigits", minimumIntegerDigits));
+    if (options.minimumIntegerDigits != NumberFormatOptions::UNSET_DIGITS) {
+        map.insert(std::make_pair("minimumIntegerDigits", GetMinimumIntegerDigits()));
     }
-    if (!minimumFractionDigits.empty()) {
-        map.insert(std::make_pair("minimumFractionDigits", minimumFractionDigits));
+    if (options.minimumFractionDigits != NumberFormatOptions::UNSET_DIGITS) {
+        map.insert(std::make_pair("minimumFractionDigits", GetMinimumFractionDigits()));
     }
-    if (!maximumFractionDigits.empty()) {
-        map.insert(std::make_pair("maximumFractionDigits", maximumFractionDigits));
+    if (options.maximumFractionDigits != NumberFormatOptions::UNSET_DIGITS) {
+        map.insert(std::make_pair("maximumFractionDigits", GetMaximumFractionDigits()));
     }
-    if (!minimumSignificantDigits.empty()) {
-        map.insert(std::make_pair("minimumSignificantDigits", minimumSignificantDigits));
+    if (options.minimumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+        map.insert(std::make_pair("minimumSignificantDigits", GetMinimumSignificantDigits()));
     }
-    if (!maximumSignificantDigits.empty()) {
-        map.insert(std::make_pair("maximumSignificantDigits", maximumSignificantDigits));
+    if (options.maximumSignificantDigits != NumberFormatOptions::UNSET_DIGITS) {
+        map.insert(std::make_pair("maximumSignificantDigits", GetMaximumSignificantDigits()));
     }
-    if (!localeMatcher.empty()) {
-        map.insert(std::make_pair("localeMatcher", localeMatcher));
+    if (options.localeMatcher != NumberFormatOptions::LOCALE_MATCHER_UNSET) {
+        map.insert(std::make_pair("localeMatcher", GetLocaleMatcher()));
     }
-    if (!notationString.empty()) {
-        map.insert(std::make_pair("notation", notationString));
+    if (options.notation != NumberFormatOptions::NOTATION_UNSET) {
+        map.insert(std::make_pair("notation", NOTATION_KEYWORDS[options.notation]));
     }
 }
 
 std::string NumberFormat::GetCurrency() const
 {
-    return currency;
+    return options.currency;
 }
 
 std::string NumberFormat::GetCurrencySign() const
 {
-    return currencySign;
+    return CURRENCY_SIGN_KEYWORDS[options.currencySign];
 }
 
 std::string NumberFormat::GetStyle() const
 {
-    return styleString;
+    return STYLE_KEYWORDS[options.style];
 }
 
 std::string NumberFormat::GetNumberingSystem() const
 {
-    return numberingSystem;
+    return options.numberingSystem;
 }
 
 std::string NumberFormat::GetUseGrouping() const
 {
-    return useGrouping;
+    return USE_GROUPING_KEYWORDS[options.useGrouping];
+}
+
+std::string DigitsToString(int32_t digits)
+{
+    return (digits == NumberFormatOptions::UNSET_DIGITS) ? "" : std::to_string(digits);
 }
 
 std::string NumberFormat::GetMinimumIntegerDigits() const
 {
-    return minimumIntegerDigits;
+    return DigitsToString(options.minimumIntegerDigits);
 }
 
 std::string NumberFormat::GetMinimumFractionDigits() const
 {
-    return minimumFractionDigits;
+    return DigitsToString(options.minimumFractionDigits);
 }
 
 std::string NumberFormat::GetMaximumFractionDigits() const
 {
-    return maximumFractionDigits;
+    return DigitsToString(options.maximumFractionDigits);
 }
 
 std::string NumberFormat::GetMinimumSignificantDigits() const
 {
-    return minimumSignificantDigits;
+    return DigitsToString(options.minimumSignificantDigits);
 }
 
 std::string NumberFormat::GetMaximumSignificantDigits() const
 {
-    return maximumSignificantDigits;
+    return DigitsToString(options.maximumSignificantDigits);
 }
 
 std::string NumberFormat::GetLocaleMatcher() const
 {
-    return localeMatcher;
-}
-
-bool NumberFormat::Init()
-{
-    SetHwIcuDirectory();
-    return true;
+    return LOCALE_MATCHER_KEYWORDS[options.localeMatcher];
 }
 } // namespace I18n
 } // namespace Global
@@ -16,6 +16,7 @@
 #include <stringpiece.h>
 
 #include "hilog/log.h"
+#include "icu_data.h"
 #include "unicode/unistr.h"
 
 #include "locale_config.h"
@@ -87,8 +88,8 @@ void PluralRules::InitPluralRules(std::vector<std::string> &localeTags,
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = icu::Locale::forLanguageTag(icu::StringPiece(curLocale), status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
-            localeInfo = std::make_unique<LocaleInfo>(curLocale, options);
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
+            localeInfo = LocaleRegistry::Acquire(curLocale, options);
             locale = localeInfo->GetLocale();
             localeStr = localeInfo->GetBaseName();
             pluralRules = icu::PluralRules::forLocale(locale, uPluralType, status);
@@ -124,6 +125,7 @@ void PluralRules::InitNumberFormatter()
 
 PluralRules::PluralRules(std::vector<std::string> &localeTags, std::map<std::string, std::string> &options)
 {
+    InitIcuData();
     ParseAllOptions(options);
     InitPluralRules(localeTags, options);
     InitNumberFormatter();
@@ -137,7 +139,7 @@ PluralRules::~PluralRules()
     }
 }
 
-std::string PluralRules::Select(double number)
+std::string PluralRules::Select(double number) const
 {
     UErrorCode status = UErrorCode::U_ZERO_ERROR;
     icu::number::FormattedNumber formattedNumber = numberFormatter.formatDouble(number, status);
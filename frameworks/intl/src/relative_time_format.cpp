@@ -14,8 +14,8 @@
  */
 #include <codecvt>
 #include <locale>
+#include "icu_data.h"
 #include "locale_config.h"
-#include "ohos/init_data.h"
 #include "relative_time_format.h"
 
 namespace OHOS {
@@ -49,6 +49,7 @@ std::unordered_map<std::string, URelativeDateTimeUnit> RelativeTimeFormat::relat
 RelativeTimeFormat::RelativeTimeFormat(const std::vector<std::string> &localeTags,
     std::map<std::string, std::string> &configs)
 {
+    InitIcuData();
     UErrorCode status = U_ZERO_ERROR;
     std::unique_ptr<icu::LocaleBuilder> builder = nullptr;
     builder = std::make_unique<icu::LocaleBuilder>();
@@ -56,8 +57,8 @@ RelativeTimeFormat::RelativeTimeFormat(const std::vector<std::string> &localeTag
     for (size_t i = 0; i < localeTags.size(); i++) {
         std::string curLocale = localeTags[i];
         locale = builder->setLanguageTag(icu::StringPiece(curLocale)).build(status);
-        if (LocaleInfo::allValidLocales.count(locale.getLanguage()) > 0) {
-            localeInfo = std::make_unique<LocaleInfo>(curLocale, configs);
+        if (LocaleInfo::IsValidLanguage(locale.getLanguage())) {
+            localeInfo = LocaleRegistry::Acquire(curLocale, configs);
             locale = localeInfo->GetLocale();
             localeBaseName = localeInfo->GetBaseName();
             relativeTimeFormat = std::make_unique<icu::RelativeDateTimeFormatter>(locale, nullptr, style,
@@ -66,7 +67,7 @@ RelativeTimeFormat::RelativeTimeFormat(const std::vector<std::string> &localeTag
         }
     }
     if (!localeInfo || !relativeTimeFormat) {
-        localeInfo = std::make_unique<LocaleInfo>(LocaleConfig::GetSystemLocale(), configs);
+        localeInfo = LocaleRegistry::Acquire(LocaleConfig::GetSystemLocale(), configs);
         locale = localeInfo->GetLocale();
         localeBaseName = localeInfo->GetBaseName();
         relativeTimeFormat = std::make_unique<icu::RelativeDateTimeFormatter>(locale, nullptr, style,
@@ -95,25 +96,26 @@ void RelativeTimeFormat::ParseConfigs(std::map<std::string, std::string> &config
     }
 }
 
-std::string RelativeTimeFormat::Format(double number, const std::string &unit)
+std::string RelativeTimeFormat::Format(double number, const std::string &unit) const
 {
-    if (!relativeUnits.count(unit)) {
+    auto relativeUnit = relativeUnits.find(unit);
+    if (relativeUnit == relativeUnits.end()) {
         return "";
     }
     UErrorCode status = U_ZERO_ERROR;
     icu::UnicodeString formattedTime;
     std::string result;
     if (!strcmp(numeric.c_str(), "always")) {
-        formattedTime = relativeTimeFormat->formatNumericToValue(number, relativeUnits[unit], status).toString(status);
+        formattedTime = relativeTimeFormat->formatNumericToValue(number, relativeUnit->second, status).toString(status);
     } else {
-        formattedTime = relativeTimeFormat->formatToValue(number, relativeUnits[unit], status).toString(status);
+        formattedTime = relativeTimeFormat->formatToValue(number, relativeUnit->second, status).toString(status);
     }
     formattedTime.toUTF8String(result);
     return result;
 }
 
 void RelativeTimeFormat::InsertInfo(std::vector<std::vector<std::string>> &timeVector,
-    const std::string &unit, bool isInteger, const std::string &value)
+    const std::string &unit, bool isInteger, const std::string &value) const
 {
     std::vector<std::string> info;
     if (isInteger) {
@@ -129,7 +131,7 @@ void RelativeTimeFormat::InsertInfo(std::vector<std::vector<std::string>> &timeV
 
 void RelativeTimeFormat::ProcessIntegerField(const std::map<size_t, size_t> &indexMap,
     std::vector<std::vector<std::string>> &timeVector, size_t &startIndex, const std::string &unit,
-    const std::string &result)
+    const std::string &result) const
 {
     for (auto iter = indexMap.begin(); iter != indexMap.end(); iter++) {
         if (iter->first > startIndex) {
@@ -141,18 +143,19 @@ void RelativeTimeFormat::ProcessIntegerField(const std::map<size_t, size_t> &ind
 }
 
 void RelativeTimeFormat::FormatToParts(double number, const std::string &unit,
-    std::vector<std::vector<std::string>> &timeVector)
+    std::vector<std::vector<std::string>> &timeVector) const
 {
-    if (!relativeUnits.count(unit)) {
+    auto relativeUnit = relativeUnits.find(unit);
+    if (relativeUnit == relativeUnits.end()) {
         return;
     }
     UErrorCode status = U_ZERO_ERROR;
     std::string result;
     icu::FormattedRelativeDateTime fmtRelativeTime;
     if (numeric.empty() || !strcmp(numeric.c_str(), "always")) {
-        fmtRelativeTime = relativeTimeFormat->formatNumericToValue(number, relativeUnits[unit], status);
+        fmtRelativeTime = relativeTimeFormat->formatNumericToValue(number, relativeUnit->second, status);
     } else {
-        fmtRelativeTime = relativeTimeFormat->formatToValue(number, relativeUnits[unit], status);
+        fmtRelativeTime = relativeTimeFormat->formatToValue(number, relativeUnit->second, status);
     }
     fmtRelativeTime.toString(status).toUTF8String(result);
     icu::ConstrainedFieldPosition constrainedPos;
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "intl_performance_test.h"
+#include <chrono>
+#include <dlfcn.h>
+#include <string_view>
+#include <unordered_map>
+#include <gtest/gtest.h>
+#include "locale_config.h"
+#include "locale_info.h"
+#include "number_format.h"
+#include "locale_tables.h"
+#include "sorted_table.h"
+
+using namespace OHOS::Global::I18n;
+using testing::ext::TestSize;
+using namespace std;
+
+namespace {
+const char *INTL_UTIL_LIBRARY = "libintl_util.z.so";
+
+class IntlPerformanceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void IntlPerformanceTest::SetUpTestCase(void)
+{}
+
+void IntlPerformanceTest::TearDownTestCase(void)
+{}
+
+void IntlPerformanceTest::SetUp(void)
+{}
+
+void IntlPerformanceTest::TearDown(void)
+{}
+
+/**
+ * @tc.name: IntlPerformanceFuncTest001
+ * @tc.desc: Record the cost of opening intl_util and of the first calls into it, which build the shared tables
+ *           lazily. The first call is only cold when this test runs first in the process.
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlPerformanceTest, IntlPerformanceFuncTest001, TestSize.Level1)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    void *handle = dlopen(INTL_UTIL_LIBRARY, RTLD_NOW);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    vector<string> languages;
+    LocaleConfig::GetSystemLanguages(languages);
+    LocaleInfo localeInfo("zh-Hans-CN");
+    vector<string> locales = { "en-US" };
+    map<string, string> options;
+    NumberFormat numFmt(locales, options);
+    string formatted = numFmt.Format(1234.5);
+    auto t3 = std::chrono::high_resolution_clock::now();
+    EXPECT_NE(handle, nullptr);
+    if (handle != nullptr) {
+        dlclose(handle);
+    }
+    EXPECT_EQ(localeInfo.GetLanguage(), "zh");
+    EXPECT_EQ(formatted, "1,234.5");
+    RecordProperty("dlopenUs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count()));
+    RecordProperty("firstCallUs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count()));
+}
+
+/**
+ * @tc.name: IntlPerformanceFuncTest002
+ * @tc.desc: Record the cost of the same calls into intl_util once the shared tables are initialized
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlPerformanceTest, IntlPerformanceFuncTest002, TestSize.Level1)
+{
+    const int rounds = 1000;
+    vector<string> locales = { "en-US" };
+    map<string, string> options;
+    size_t length = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < rounds; ++k) {
+        vector<string> languages;
+        LocaleConfig::GetSystemLanguages(languages);
+        LocaleInfo localeInfo("zh-Hans-CN");
+        NumberFormat numFmt(locales, options);
+        length += numFmt.Format(1234.5).length();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(length, rounds * string("1,234.5").length());
+    RecordProperty("warmCallNs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / rounds));
+}
+
+/**
+ * @tc.name: IntlPerformanceFuncTest003
+ * @tc.desc: Compare the lookups of the dialect and language tables of LocaleConfig with the unordered_map lookups
+ *           they replaced, which hold the same entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlPerformanceTest, IntlPerformanceFuncTest003, TestSize.Level1)
+{
+    unordered_map<string, string> dialectMap;
+    for (const TableEntry &entry : DIALECT_MAP) {
+        dialectMap.emplace(string(entry.key), string(entry.value));
+    }
+    unordered_map<string, string> languageMap;
+    for (const TableEntry &entry : LANGUAGE_MAP) {
+        languageMap.emplace(string(entry.key), string(entry.value));
+    }
+    vector<string> keys;
+    for (const TableEntry &entry : DIALECT_MAP) {
+        keys.push_back(string(entry.key));
+    }
+    for (const TableEntry &entry : LANGUAGE_MAP) {
+        keys.push_back(string(entry.key) + "-CN");
+    }
+    keys.insert(keys.end(), { "fr-Latn-FR", "es-Latn-ES", "zh-Hani", "en", "" });
+    const int rounds = 1000;
+    size_t tableHits = 0;
+    size_t mapHits = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < rounds; ++k) {
+        for (const string &key : keys) {
+            tableHits += TableFind(DIALECT_MAP, key).size() + TableFindPrefix(LANGUAGE_MAP, key).size();
+        }
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < rounds; ++k) {
+        for (const string &key : keys) {
+            auto dialect = dialectMap.find(key);
+            mapHits += (dialect == dialectMap.end()) ? 0 : dialect->second.size();
+            // the language map was scanned for the first key the text starts with.
+            for (auto iter = languageMap.begin(); iter != languageMap.end(); ++iter) {
+                if (!key.compare(0, iter->first.length(), iter->first)) {
+                    mapHits += iter->second.size();
+                    break;
+                }
+            }
+        }
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(tableHits, mapHits);
+    for (const string &key : keys) {
+        auto dialect = dialectMap.find(key);
+        EXPECT_EQ(TableFind(DIALECT_MAP, key), (dialect == dialectMap.end()) ? string() : dialect->second);
+    }
+    int lookups = rounds * static_cast<int>(keys.size());
+    RecordProperty("sortedTableNs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / lookups));
+    RecordProperty("unorderedMapNs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count() / lookups));
+}
+
+/**
+ * @tc.name: IntlPerformanceFuncTest004
+ * @tc.desc: Test the construction throughput of LocaleInfo for common tags
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlPerformanceTest, IntlPerformanceFuncTest004, TestSize.Level1)
+{
+    vector<string> tags = { "zh-Hans-CN", "en-Latn-US", "ar-EG-u-nu-arab", "ja-JP-u-ca-japanese-hc-h12" };
+    map<string, string> options = { { "numberingSystem", "latn" }, { "style", "decimal" } };
+    size_t length = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < 10000; ++k) {
+        LocaleInfo localeInfo(tags[k % tags.size()], options);
+        length += localeInfo.ToString().length();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    EXPECT_GT(length, 0);
+    RecordProperty("localeInfoNs", static_cast<int>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() / 10000));
+}
+}
@@ -15,11 +15,21 @@
 
 #include "intl_test.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <fstream>
 #include <map>
+#include <thread>
 #include <vector>
+#include "collator.h"
 #include "date_time_format.h"
+#include "index_util.h"
+#include "locale_handle.h"
 #include "locale_info.h"
+#include "measure_data.h"
 #include "number_format.h"
+#include "plural_rules.h"
+#include "relative_time_format.h"
 
 using namespace OHOS::Global::I18n;
 using testing::ext::TestSize;
@@ -463,4 +473,686 @@ HWTEST_F(IntlTest, IntlFuncTest0015, TestSize.Level1)
     EXPECT_EQ(dateFormat->GetTimeZoneName(), "long");
     delete dateFormat;
 }
+
+/**
+ * @tc.name: IntlFuncTest0016
+ * @tc.desc: Test Intl LocaleRegistry
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0016, TestSize.Level1)
+{
+    LocaleRegistry::Clear();
+    map<string, string> options = { { "numberingSystem", "arab" }, { "style", "percent" } };
+    map<string, string> otherOptions = { { "numberingSystem", "arab" }, { "style", "decimal" } };
+    LocaleHandle handle = LocaleRegistry::Acquire("ar-EG", options);
+    EXPECT_EQ(handle, LocaleRegistry::Acquire("ar-EG", otherOptions));
+    EXPECT_EQ(handle->ToString(), "ar-EG-u-nu-arab");
+    map<string, string> latnOptions = { { "numberingSystem", "latn" } };
+    EXPECT_NE(handle, LocaleRegistry::Acquire("ar-EG", latnOptions));
+    map<string, string> empty;
+    size_t capacity = LocaleRegistry::CAPACITY;
+    for (size_t i = 0; i < capacity; ++i) {
+        LocaleRegistry::Acquire("en-US-u-nu-" + string(3, 'a' + i % 26) + to_string(i), empty);
+    }
+    EXPECT_EQ(LocaleRegistry::Size(), capacity);
+    EXPECT_NE(handle, LocaleRegistry::Acquire("ar-EG", options));
+    EXPECT_EQ(handle->GetNumberingSystem(), "arab");
+}
+
+/**
+ * @tc.name: IntlFuncTest0017
+ * @tc.desc: Test Intl LocaleInfo IsValidLanguage
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0017, TestSize.Level1)
+{
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("zh"));
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("yue"));
+    EXPECT_TRUE(LocaleInfo::IsValidLanguage("iw"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("jessie"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("zz"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("ZH"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage("z"));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage(""));
+    EXPECT_FALSE(LocaleInfo::IsValidLanguage(nullptr));
+}
+
+/**
+ * @tc.name: IntlFuncTest0018
+ * @tc.desc: Test Intl FindMeasureUnit
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0018, TestSize.Level1)
+{
+    const icu::MeasureUnit *meter = FindMeasureUnit("meter");
+    ASSERT_TRUE(meter != nullptr);
+    EXPECT_EQ(string(meter->getType()), "length");
+    EXPECT_EQ(meter, FindMeasureUnit("meter"));
+    EXPECT_TRUE(FindMeasureUnit("jessie") == nullptr);
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "unit" }, { "unit", "kilometer-per-hour" }, { "unitDisplay", "long" } };
+    NumberFormat numFmt(locales, options);
+    EXPECT_EQ(numFmt.Format(50), "50 kilometers per hour");
+}
+
+/**
+ * @tc.name: IntlFuncTest0019
+ * @tc.desc: Test Intl NumberFormat formatter cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0019, TestSize.Level1)
+{
+    vector<string> locales = { "de-DE" };
+    map<string, string> options = { { "style", "currency" }, { "currency", "EUR" }, { "maximumFractionDigits", "1" } };
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    NumberFormat::GetFormatterCacheStats(hits, misses);
+    NumberFormat first(locales, options);
+    NumberFormat second(locales, options);
+    uint64_t newHits = 0;
+    uint64_t newMisses = 0;
+    NumberFormat::GetFormatterCacheStats(newHits, newMisses);
+    EXPECT_GE(newHits, hits + 1);
+    EXPECT_EQ(first.Format(1234.56), second.Format(1234.56));
+    EXPECT_EQ(second.GetCurrency(), "EUR");
+    options["maximumFractionDigits"] = "2";
+    NumberFormat third(locales, options);
+    EXPECT_NE(first.Format(1234.56), third.Format(1234.56));
+    // option sets not built before miss the cache once, and hit it when they are built again.
+    vector<string> frLocales = { "fr-CH" };
+    const int maxIntegerDigits = 10;
+    const int maxFractionDigits = 4;
+    vector<map<string, string>> uncachedOptions;
+    for (int i = 2; i < maxIntegerDigits; ++i) {
+        for (int j = 0; j < maxFractionDigits; ++j) {
+            uncachedOptions.push_back({ { "minimumIntegerDigits", to_string(i) },
+                { "maximumFractionDigits", to_string(j) } });
+        }
+    }
+    NumberFormat::GetFormatterCacheStats(hits, misses);
+    for (map<string, string> &uncached : uncachedOptions) {
+        NumberFormat numFmt(frLocales, uncached);
+    }
+    NumberFormat::GetFormatterCacheStats(newHits, newMisses);
+    EXPECT_EQ(newHits, hits);
+    EXPECT_EQ(newMisses, misses + uncachedOptions.size());
+    for (map<string, string> &cached : uncachedOptions) {
+        NumberFormat numFmt(frLocales, cached);
+    }
+    NumberFormat::GetFormatterCacheStats(hits, misses);
+    EXPECT_EQ(hits, newHits + uncachedOptions.size());
+    EXPECT_EQ(misses, newMisses);
+}
+
+/**
+ * @tc.name: IntlFuncTest0020
+ * @tc.desc: Test Intl NumberFormat FormatBatch
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0020, TestSize.Level1)
+{
+    vector<string> locales = { "fr-FR" };
+    map<string, string> options = { { "style", "percent" } };
+    NumberFormat numFmt(locales, options);
+    double numbers[] = { 0.25, -1.5, 12345.678, 0 };
+    size_t count = sizeof(numbers) / sizeof(numbers[0]);
+    string arena;
+    vector<size_t> offsets;
+    numFmt.FormatBatch(numbers, count, arena, offsets);
+    ASSERT_EQ(offsets.size(), count + 1);
+    EXPECT_EQ(offsets.back(), arena.length());
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(arena.substr(offsets[i], offsets[i + 1] - offsets[i]), numFmt.Format(numbers[i]));
+    }
+    numFmt.FormatBatch(nullptr, 0, arena, offsets);
+    EXPECT_TRUE(arena.empty());
+    EXPECT_EQ(offsets.size(), 1);
+    numFmt.FormatBatch(nullptr, count, arena, offsets);
+    EXPECT_TRUE(arena.empty());
+    EXPECT_EQ(offsets, vector<size_t>(count + 1, 0));
+}
+
+/**
+ * @tc.name: IntlFuncTest0021
+ * @tc.desc: Test Intl NumberFormat with unitUsage
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0021, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "unit" }, { "unit", "meter" }, { "unitUsage", "default" } };
+    NumberFormat numFmt(locales, options);
+    EXPECT_EQ(numFmt.Format(1), "3.3 ft");
+    EXPECT_EQ(numFmt.Format(0.3), "12 in");
+    EXPECT_EQ(numFmt.Format(1), "3.3 ft");
+    options["unitUsage"] = "jessie";
+    NumberFormat otherFmt(locales, options);
+    EXPECT_EQ(otherFmt.Format(2), "2 m");
+}
+
+/**
+ * @tc.name: IntlFuncTest0022
+ * @tc.desc: Test Intl NumberFormat and DateTimeFormat utf-16 output
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0022, TestSize.Level1)
+{
+    // every output is checked against a formatter built from icu directly, after the next value is formatted.
+    vector<string> tags = { "zh-Hans-CN", "de-DE", "en-US", "ja-JP", "fr-FR" };
+    vector<map<string, string>> numberOptions = {
+        { { "style", "currency" }, { "currency", "CNY" } },
+        { { "style", "currency" }, { "currency", "EUR" } },
+        {},
+        { { "notation", "compact" }, { "compactDisplay", "short" } },
+        { { "notation", "scientific" } },
+    };
+    vector<icu::UnicodeString> skeletons = { u"currency/CNY", u"currency/EUR", u"", u"compact-short", u"scientific" };
+    const int steps = 200;
+    for (size_t i = 0; i < tags.size(); ++i) {
+        vector<string> locales = { tags[i] };
+        NumberFormat numFmt(locales, numberOptions[i]);
+        UErrorCode status = U_ZERO_ERROR;
+        icu::number::LocalizedNumberFormatter expected = icu::number::NumberFormatter::forSkeleton(skeletons[i],
+            status).locale(icu::Locale::forLanguageTag(tags[i], status));
+        ASSERT_TRUE(U_SUCCESS(status));
+        icu::UnicodeString previous;
+        double previousValue = 0;
+        for (int k = -steps; k <= steps; ++k) {
+            double value = k * pow(10.0, (k + steps) % 12 - 4) * 1.2345;
+            icu::UnicodeString current;
+            numFmt.Format(value, current);
+            if (k > -steps) {
+                EXPECT_EQ(previous, expected.formatDouble(previousValue, status).toString(status));
+            }
+            previous = current;
+            previousValue = value;
+        }
+        EXPECT_EQ(previous, expected.formatDouble(previousValue, status).toString(status));
+    }
+    vector<string> locales = { "zh-Hans-CN" };
+    string utf8;
+    map<string, string> dateOptions = { { "dateStyle", "full" } };
+    DateTimeFormat dateFormat(locales, dateOptions);
+    int64_t date[] = { 2021, 8, 15, 10, 30, 0 };
+    size_t size = sizeof(date) / sizeof(date[0]);
+    icu::UnicodeString formatted;
+    dateFormat.Format(date, size, formatted);
+    utf8.clear();
+    EXPECT_EQ(formatted.toUTF8String(utf8), dateFormat.Format(date, size));
+    int64_t toDate[] = { 2021, 8, 20, 10, 30, 0 };
+    dateFormat.FormatRange(date, size, toDate, size, formatted);
+    utf8.clear();
+    EXPECT_EQ(formatted.toUTF8String(utf8), dateFormat.FormatRange(date, size, toDate, size));
+}
+
+/**
+ * @tc.name: IntlFuncTest0023
+ * @tc.desc: Test Intl NumberFormat FormatToParts
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0023, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "currency" }, { "currency", "USD" }, { "signDisplay", "always" } };
+    NumberFormat numFmt(locales, options);
+    icu::UnicodeString formatted;
+    vector<NumberFormatPart> parts;
+    numFmt.FormatToParts(1234567.5, formatted, parts);
+    string utf8;
+    EXPECT_EQ(formatted.toUTF8String(utf8), "+$1,234,567.50");
+    string types;
+    int32_t end = 0;
+    for (const NumberFormatPart &part : parts) {
+        EXPECT_EQ(part.begin, end);
+        end = part.end;
+        types += string(NumberFormat::GetPartType(formatted, part)) + " ";
+    }
+    EXPECT_EQ(end, formatted.length());
+    EXPECT_EQ(types, "plusSign currency integer group integer group integer decimal fraction ");
+    numFmt.FormatToParts(-3, formatted, parts);
+    ASSERT_FALSE(parts.empty());
+    EXPECT_EQ(string(NumberFormat::GetPartType(formatted, parts[0])), "minusSign");
+}
+
+/**
+ * @tc.name: IntlFuncTest0024
+ * @tc.desc: Test Intl NumberFormat with typed NumberFormatOptions
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0024, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    NumberFormatOptions typedOptions;
+    EXPECT_TRUE(typedOptions.SetOption("style", "currency"));
+    EXPECT_TRUE(typedOptions.SetOption("currency", "EUR"));
+    EXPECT_TRUE(typedOptions.SetOption("currencyDisplay", "code"));
+    EXPECT_TRUE(typedOptions.SetDigitsOption("minimumFractionDigits", 3));
+    EXPECT_FALSE(typedOptions.SetOption("region", "US"));
+    EXPECT_FALSE(typedOptions.SetDigitsOption("maximumFractionDigits", -1));
+    typedOptions.useGrouping = NumberFormatOptions::USE_GROUPING_TRUE;
+    EXPECT_EQ(typedOptions.style, NumberFormatOptions::STYLE_CURRENCY);
+    EXPECT_EQ(typedOptions.currencyDisplay, NumberFormatOptions::CURRENCY_DISPLAY_CODE);
+    map<string, string> configs = { { "style", "currency" }, { "currency", "EUR" }, { "currencyDisplay", "code" },
+        { "minimumFractionDigits", "3" }, { "useGrouping", "true" } };
+    NumberFormat typedFormat(locales, typedOptions);
+    NumberFormat mapFormat(locales, configs);
+    EXPECT_EQ(typedFormat.Format(1234.5), mapFormat.Format(1234.5));
+    map<string, string> typedResolved;
+    map<string, string> mapResolved;
+    typedFormat.GetResolvedOptions(typedResolved);
+    mapFormat.GetResolvedOptions(mapResolved);
+    EXPECT_EQ(typedResolved, mapResolved);
+    EXPECT_EQ(typedResolved["currencyDisplay"], "code");
+    EXPECT_EQ(typedFormat.GetMinimumFractionDigits(), "3");
+    EXPECT_EQ(typedFormat.GetMaximumFractionDigits(), "");
+    EXPECT_EQ(typedFormat.GetUseGrouping(), "true");
+}
+
+struct SharedFormatters {
+    const NumberFormat *numberFormat;
+    const DateTimeFormat *dateFormat;
+    const Collator *collator;
+    const PluralRules *pluralRules;
+    const RelativeTimeFormat *relativeTimeFormat;
+    const IndexUtil *indexUtil;
+    string number;
+    string date;
+    string dateRange;
+    string plural;
+    string relativeTime;
+    string index;
+    atomic<int> mismatches;
+};
+
+void FormatConcurrently(SharedFormatters *shared)
+{
+    const int iterations = 200;
+    int64_t date[] = { 2021, 8, 15, 10, 30, 0 };
+    int64_t toDate[] = { 2021, 9, 20, 23, 5, 7 };
+    size_t size = sizeof(date) / sizeof(date[0]);
+    for (int i = 0; i < iterations; ++i) {
+        if (shared->numberFormat->Format(1234567.891) != shared->number ||
+            shared->dateFormat->Format(date, size) != shared->date ||
+            shared->dateFormat->FormatRange(date, size, toDate, size) != shared->dateRange ||
+            shared->collator->Compare("apple", "banana") != CompareResult::SMALLER ||
+            shared->pluralRules->Select(1) != shared->plural ||
+            shared->relativeTimeFormat->Format(-3, "day") != shared->relativeTime ||
+            shared->indexUtil->GetIndex("Zebra") != shared->index) {
+            shared->mismatches++;
+        }
+    }
+}
+
+/**
+ * @tc.name: IntlFuncTest0025
+ * @tc.desc: Test Intl formatters shared between threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0025, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    map<string, string> numberOptions = { { "style", "currency" }, { "currency", "EUR" } };
+    map<string, string> dateOptions = { { "timeZone", "Asia/Shanghai" }, { "dateStyle", "medium" },
+        { "timeStyle", "short" } };
+    map<string, string> emptyOptions;
+    NumberFormat numberFormat(locales, numberOptions);
+    DateTimeFormat dateFormat(locales, dateOptions);
+    Collator collator(locales, emptyOptions);
+    PluralRules pluralRules(locales, emptyOptions);
+    RelativeTimeFormat relativeTimeFormat(locales, emptyOptions);
+    IndexUtil indexUtil("en-US");
+    int64_t date[] = { 2021, 8, 15, 10, 30, 0 };
+    int64_t toDate[] = { 2021, 9, 20, 23, 5, 7 };
+    size_t size = sizeof(date) / sizeof(date[0]);
+    SharedFormatters shared = { &numberFormat, &dateFormat, &collator, &pluralRules, &relativeTimeFormat,
+        &indexUtil, numberFormat.Format(1234567.891), dateFormat.Format(date, size),
+        dateFormat.FormatRange(date, size, toDate, size), pluralRules.Select(1), relativeTimeFormat.Format(-3, "day"),
+        indexUtil.GetIndex("Zebra"), 0 };
+    EXPECT_EQ(dateFormat.Format(date, size), shared.date);
+    EXPECT_EQ(shared.number, "€1,234,567.89");
+    EXPECT_EQ(shared.plural, "one");
+    EXPECT_EQ(shared.relativeTime, "3 days ago");
+    EXPECT_EQ(shared.index, "Z");
+    const int threadCount = 8;
+    vector<thread> workers;
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(FormatConcurrently, &shared);
+    }
+    for (thread &worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(shared.mismatches, 0);
+}
+
+/**
+ * @tc.name: IntlFuncTest0026
+ * @tc.desc: Test NumberFormat compact and scientific notations against icu
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0026, TestSize.Level1)
+{
+    const char *locales[] = { "en", "de", "fr", "ru", "pl", "ar", "he", "fa", "hi", "bn", "ja", "zh", "ko", "es",
+        "pt", "it", "tr", "el", "th", "sw", "my", "zh-Hant", "ar-EG" };
+    const char *notations[][2] = { { "compact", "short" }, { "compact", "long" }, { "scientific", "" },
+        { "engineering", "" } };
+    icu::number::Notation icuNotations[] = { icu::number::Notation::compactShort(),
+        icu::number::Notation::compactLong(), icu::number::Notation::scientific(),
+        icu::number::Notation::engineering() };
+    vector<double> numbers = { 0, 0.5, 1.25, 1e15, -1e15 };
+    const int maxMagnitude = 14;
+    double power = 1;
+    for (int i = 0; i <= maxMagnitude; ++i, power *= 10) {
+        double scales[] = { 1, 1.05, 1.15, 1.25, 1.5, 2.5, 9.949, 9.95 };
+        numbers.push_back(power - 1);
+        for (double scale : scales) {
+            numbers.push_back(floor(power * scale));
+        }
+    }
+    uint64_t seed = 1;
+    const int randomCount = 200;
+    for (int i = 0; i < randomCount; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        numbers.push_back(static_cast<double>((seed >> 11) % 1000000000000000ULL) / power * (seed % 1000));
+    }
+    size_t positiveCount = numbers.size();
+    for (size_t i = 0; i < positiveCount; ++i) {
+        numbers.push_back(-numbers[i]);
+    }
+    int mismatches = 0;
+    for (const char *tag : locales) {
+        UErrorCode status = U_ZERO_ERROR;
+        icu::Locale locale = icu::Locale::forLanguageTag(tag, status);
+        for (size_t i = 0; i < sizeof(notations) / sizeof(notations[0]); ++i) {
+            vector<string> tags = { tag };
+            map<string, string> options = { { "notation", notations[i][0] } };
+            if (*notations[i][1]) {
+                options["compactDisplay"] = notations[i][1];
+            }
+            NumberFormat numberFormat(tags, options);
+            icu::number::LocalizedNumberFormatter expected =
+                icu::number::NumberFormatter::withLocale(locale).notation(icuNotations[i]);
+            for (double number : numbers) {
+                icu::UnicodeString result;
+                numberFormat.Format(number, result);
+                if (result != expected.formatDouble(number, status).toString(status)) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+    vector<string> english = { "en" };
+    map<string, string> shortOptions = { { "notation", "compact" }, { "compactDisplay", "short" } };
+    map<string, string> longOptions = { { "notation", "compact" }, { "compactDisplay", "long" } };
+    map<string, string> scientificOptions = { { "notation", "scientific" } };
+    NumberFormat shortFormat(english, shortOptions);
+    NumberFormat longFormat(english, longOptions);
+    NumberFormat scientificFormat(english, scientificOptions);
+    EXPECT_EQ(shortFormat.Format(1234), "1.2K");
+    EXPECT_EQ(shortFormat.Format(-999999), "-1M");
+    EXPECT_EQ(longFormat.Format(1250000), "1.2 million");
+    EXPECT_EQ(scientificFormat.Format(123456), "1.23456E5");
+}
+
+/**
+ * @tc.name: IntlFuncTest0027
+ * @tc.desc: Test NumberFormat integers of every supported locale against icu
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0027, TestSize.Level1)
+{
+    ifstream file("/system/usr/ohos_locale_config/supported_locales.xml");
+    vector<string> locales;
+    string line;
+    const string itemBegin = "<item>";
+    const string itemEnd = "</item>";
+    while (getline(file, line)) {
+        size_t begin = line.find(itemBegin);
+        size_t end = line.find(itemEnd);
+        if (begin != string::npos && end != string::npos) {
+            begin += itemBegin.length();
+            locales.push_back(line.substr(begin, end - begin));
+        }
+    }
+    EXPECT_FALSE(locales.empty());
+    vector<double> numbers = { 0, 0.5, -0.0, 1e15, 123456.5 };
+    double power = 1;
+    const int maxMagnitude = 15;
+    for (int i = 0; i <= maxMagnitude; ++i, power *= 10) {
+        numbers.push_back(power);
+        numbers.push_back(power - 1);
+        numbers.push_back(floor(power * 1.2345678901234));
+    }
+    size_t positiveCount = numbers.size();
+    for (size_t i = 0; i < positiveCount; ++i) {
+        numbers.push_back(-numbers[i]);
+    }
+    int mismatches = 0;
+    map<string, string> options;
+    for (const string &tag : locales) {
+        UErrorCode status = U_ZERO_ERROR;
+        vector<string> tags = { tag };
+        NumberFormat numberFormat(tags, options);
+        // locales of unsupported languages fall back to the system locale.
+        map<string, string> resolved;
+        numberFormat.GetResolvedOptions(resolved);
+        icu::number::LocalizedNumberFormatter expected =
+            icu::number::NumberFormatter::withLocale(icu::Locale::forLanguageTag(resolved["locale"], status));
+        for (double number : numbers) {
+            string result;
+            expected.formatDouble(number, status).toString(status).toUTF8String(result);
+            if (numberFormat.Format(number) != result) {
+                ++mismatches;
+            }
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+    vector<string> hindi = { "hi-IN" };
+    NumberFormat hindiFormat(hindi, options);
+    EXPECT_EQ(hindiFormat.Format(-12345678), "-1,23,45,678");
+}
+
+/**
+ * @tc.name: IntlFuncTest0028
+ * @tc.desc: Test Convert of measure data
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0028, TestSize.Level1)
+{
+    double value = 1;
+    EXPECT_EQ(Convert(value, "foot", "", "inch", ""), 1);
+    EXPECT_DOUBLE_EQ(value, 12);
+    value = 100;
+    EXPECT_EQ(Convert(value, "celsius", "", "fahrenheit", ""), 1);
+    EXPECT_DOUBLE_EQ(value, 212);
+    value = 1;
+    EXPECT_EQ(Convert(value, "gallon", "", "liter", ""), 1);
+    EXPECT_DOUBLE_EQ(value, 3.785411784);
+    value = 1;
+    EXPECT_EQ(Convert(value, "cup", "US", "cup", "UK"), 1);
+    EXPECT_NEAR(value, 0.832674, 1e-6);
+    value = 1;
+    EXPECT_EQ(Convert(value, "kilometer-per-hour", "", "meter-per-second", ""), 1);
+    EXPECT_DOUBLE_EQ(value, 1 / 3.6);
+    value = 1;
+    EXPECT_EQ(Convert(value, "hectare", "", "square-foot", ""), 1);
+    EXPECT_NEAR(value, 107639.104, 1e-3);
+    value = 5;
+    EXPECT_EQ(Convert(value, "meter", "", "second", ""), 0);
+    EXPECT_EQ(Convert(value, "meter", "", "unknown-unit", ""), 0);
+    EXPECT_EQ(value, 5);
+    // every unit converted to the meter agrees with the factors computed from the unit name.
+    const UnitConversion *meter = FindUnitConversion("meter", "");
+    ASSERT_TRUE(meter != nullptr);
+    for (auto &measureUnit : GetMeasureUnits()) {
+        vector<double> factors = { 0.0, 0.0 };
+        const UnitConversion *conversion = FindUnitConversion(measureUnit.first, "US");
+        if (strcmp(measureUnit.second.getType(), "length") || !ComputeValue(measureUnit.first, "US", factors)) {
+            continue;
+        }
+        ASSERT_TRUE(conversion != nullptr);
+        EXPECT_EQ(conversion->typeId, meter->typeId);
+        EXPECT_EQ(conversion->factor, factors[0]);
+        EXPECT_EQ(conversion->offset, factors[1]);
+    }
+}
+
+/**
+ * @tc.name: IntlFuncTest0029
+ * @tc.desc: Test ConvertBatch of measure data
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0029, TestSize.Level1)
+{
+    const size_t count = 37;
+    double in[count];
+    double out[count];
+    for (size_t i = 0; i < count; ++i) {
+        in[i] = -40.0 + 3.7 * i;
+    }
+    const char *pairs[][2] = { { "celsius", "fahrenheit" }, { "kilometer-per-hour", "mile-per-hour" },
+        { "liter", "gallon" }, { "foot", "meter" } };
+    for (auto &pair : pairs) {
+        EXPECT_EQ(ConvertBatch(in, out, count, pair[0], "", pair[1], "US"), 1);
+        for (size_t i = 0; i < count; ++i) {
+            double value = in[i];
+            EXPECT_EQ(Convert(value, pair[0], "", pair[1], "US"), 1);
+            EXPECT_EQ(out[i], value);
+        }
+    }
+    double values[] = { 0, 100 };
+    EXPECT_EQ(ConvertBatch(values, values, 2, "celsius", "", "fahrenheit", ""), 1);
+    EXPECT_DOUBLE_EQ(values[0], 32);
+    EXPECT_DOUBLE_EQ(values[1], 212);
+    EXPECT_EQ(ConvertBatch(values, values, 2, "celsius", "", "meter", ""), 0);
+    EXPECT_DOUBLE_EQ(values[1], 212);
+    EXPECT_EQ(ConvertBatch(nullptr, nullptr, 0, "celsius", "", "kelvin", ""), 1);
+    const UnitConversion *celsius = FindUnitConversion("celsius", "");
+    const UnitConversion *fahrenheit = FindUnitConversion("fahrenheit", "");
+    ASSERT_TRUE(celsius != nullptr && fahrenheit != nullptr);
+    EXPECT_DOUBLE_EQ(ApplyUnitConversion(100, *celsius, *fahrenheit), 212);
+}
+
+/**
+ * @tc.name: IntlFuncTest0030
+ * @tc.desc: Test unit preferences of measure data
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0030, TestSize.Level1)
+{
+    const char *cases[][3] = {
+        { "US", "length-road", "mile" },
+        { "FR", "length-road", "kilometer" },
+        { "US", "length-road-small", "mile" },
+        { "US", "volume-vehicle-fuel", "gallon" },
+        { "US", "temperature-default", "fahrenheit" },
+        { "", "speed-default", "kilometer-per-hour" },
+        { "US", "length-person-height", "foot-and-inch" },
+    };
+    for (auto &item : cases) {
+        UnitPreferences preferences = GetUnitPreferences(item[0], item[1]);
+        ASSERT_GT(preferences.count, 0U);
+        EXPECT_EQ(preferences.units[0].unit, item[2]);
+    }
+    UnitPreferences height = GetUnitPreferences("US", "length-person-height");
+    EXPECT_DOUBLE_EQ(height.units[0].geq, 3.0);
+    EXPECT_EQ(GetUnitPreferences("US", "foo-bar").count, 0U);
+
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "unit" }, { "unit", "kilometer" }, { "unitUsage", "length-road" } };
+    NumberFormat numFmt(locales, options);
+    EXPECT_EQ(numFmt.Format(16.09344), "10 mi");
+}
+
+/**
+ * @tc.name: IntlFuncTest0031
+ * @tc.desc: Test Intl NumberFormat with unitUsage of mixed units and its default rounding
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0031, TestSize.Level1)
+{
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "unit" }, { "unit", "meter" },
+        { "unitUsage", "length-person-height" } };
+    NumberFormat numFmt(locales, options);
+    EXPECT_EQ(numFmt.Format(1.8034), "5 ft, 11 in");
+    EXPECT_EQ(numFmt.Format(1.82879999), "6 ft, 0 in");
+    EXPECT_EQ(numFmt.Format(-1.8034), "-5 ft, 11 in");
+    EXPECT_EQ(numFmt.Format(0.5), "20 in");
+    double numbers[] = { 1.8034, 0.5 };
+    string arena;
+    vector<size_t> offsets;
+    numFmt.FormatBatch(numbers, 2, arena, offsets);
+    EXPECT_EQ(arena, "5 ft, 11 in20 in");
+    options["unitDisplay"] = "long";
+    NumberFormat longFmt(locales, options);
+    EXPECT_EQ(longFmt.Format(1.8034), "5 feet, 11 inches");
+    options["unitUsage"] = "length-road";
+    NumberFormat roadFmt(locales, options);
+    EXPECT_EQ(roadFmt.Format(16.09344), "50 feet");
+    EXPECT_EQ(roadFmt.Format(2000), "1.2 miles");
+    options["maximumFractionDigits"] = "1";
+    NumberFormat digitsFmt(locales, options);
+    EXPECT_EQ(digitsFmt.Format(16.09344), "52.8 feet");
+    map<string, string> defaultOptions = { { "style", "unit" }, { "unit", "meter" }, { "unitUsage", "default" } };
+    NumberFormat defaultFmt(locales, defaultOptions);
+    EXPECT_EQ(defaultFmt.Format(1.8), "5.9 ft");
+    EXPECT_EQ(defaultFmt.Format(-1.8), "-5.9 ft");
+    map<string, string> landOptions = { { "style", "unit" }, { "unit", "square-meter" }, { "unitUsage", "area-land" } };
+    NumberFormat landFmt(locales, landOptions);
+    EXPECT_EQ(landFmt.Format(1.8), "0.00044 ac");
+    EXPECT_EQ(landFmt.Format(-1.8), "-0.00044 ac");
+    map<string, string> rainOptions = { { "style", "unit" }, { "unit", "millimeter" },
+        { "unitUsage", "length-rainfall" } };
+    NumberFormat rainFmt(locales, rainOptions);
+    EXPECT_EQ(rainFmt.Format(16.1), "0.63 in");
+}
+
+/**
+ * @tc.name: IntlFuncTest0032
+ * @tc.desc: Test Intl NumberFormat FormatToParts joins to the text of Format
+ * @tc.type: FUNC
+ */
+HWTEST_F(IntlTest, IntlFuncTest0032, TestSize.Level1)
+{
+    vector<pair<string, map<string, string>>> formats = {
+        { "en-US", {} },
+        { "de-DE", { { "notation", "scientific" } } },
+        { "fr-FR", { { "notation", "engineering" } } },
+        { "ja-JP", { { "notation", "compact" }, { "compactDisplay", "short" } } },
+        { "en-US", { { "notation", "compact" }, { "compactDisplay", "long" } } },
+        { "zh-Hans-CN", { { "style", "currency" }, { "currency", "CNY" } } },
+        { "en-US", { { "style", "unit" }, { "unit", "meter" }, { "unitUsage", "length-person-height" } } },
+        { "en-US", { { "style", "unit" }, { "unit", "meter" }, { "unitUsage", "length-person-height" },
+            { "unitDisplay", "long" } } },
+    };
+    vector<double> numbers = { 0, 0.5, 1.8034, -1.8034, 1.82879999, 12.5, -1234.5678, 98765432.1, 1e-7, 3e15 };
+    for (auto &format : formats) {
+        vector<string> locales = { format.first };
+        NumberFormat numFmt(locales, format.second);
+        for (double number : numbers) {
+            icu::UnicodeString formatted;
+            vector<NumberFormatPart> parts;
+            numFmt.FormatToParts(number, formatted, parts);
+            icu::UnicodeString joined;
+            for (const NumberFormatPart &part : parts) {
+                joined.append(formatted, part.begin, part.end - part.begin);
+            }
+            string utf8;
+            EXPECT_EQ(joined.toUTF8String(utf8), numFmt.Format(number));
+        }
+    }
+    vector<string> locales = { "en-US" };
+    map<string, string> options = { { "style", "unit" }, { "unit", "meter" },
+        { "unitUsage", "length-person-height" } };
+    NumberFormat mixedFmt(locales, options);
+    icu::UnicodeString formatted;
+    vector<NumberFormatPart> parts;
+    mixedFmt.FormatToParts(-1.8034, formatted, parts);
+    string types;
+    for (const NumberFormatPart &part : parts) {
+        types += string(NumberFormat::GetPartType(formatted, part)) + " ";
+    }
+    EXPECT_EQ(types, "minusSign integer literal unit literal integer literal unit ");
+}
 }
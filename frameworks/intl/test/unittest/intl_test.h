@@ -35,4 +35,17 @@ int IntlFuncTest0016();
 int IntlFuncTest0017();
 int IntlFuncTest0018();
 int IntlFuncTest0019();
+int IntlFuncTest0020();
+int IntlFuncTest0021();
+int IntlFuncTest0022();
+int IntlFuncTest0023();
+int IntlFuncTest0024();
+int IntlFuncTest0025();
+int IntlFuncTest0026();
+int IntlFuncTest0027();
+int IntlFuncTest0028();
+int IntlFuncTest0029();
+int IntlFuncTest0030();
+int IntlFuncTest0031();
+int IntlFuncTest0032();
 #endif
\ No newline at end of file
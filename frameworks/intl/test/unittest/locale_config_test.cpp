@@ -15,7 +15,10 @@
 
 #include "locale_config_test.h"
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
 #include "locale_config.h"
+#include "locale_config_snapshot.h"
 #include "parameter.h"
 
 using namespace OHOS::Global::I18n;
@@ -43,6 +46,58 @@ void LocaleConfigTest::SetUp(void)
 void LocaleConfigTest::TearDown(void)
 {}
 
+const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+void WriteFile(const string &path, const string &content)
+{
+    ofstream file(path, ios::binary | ios::trunc);
+    file << content;
+}
+
+template<typename T>
+void AppendValue(string &out, T value)
+{
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// writes the layout of tools/locale_config_snapshot.py for the sources and the sorted lists.
+string BuildSnapshot(const vector<string> &sources, const vector<vector<string>> &lists)
+{
+    const uint32_t headerSize = 24;
+    const uint32_t sourceEntrySize = 16;
+    const uint32_t listEntrySize = 8;
+    uint32_t tableOffset = headerSize + sourceEntrySize * sources.size() + listEntrySize * lists.size();
+    string listEntries;
+    string tables;
+    string pool;
+    for (const vector<string> &items : lists) {
+        AppendValue<uint32_t>(listEntries, items.size());
+        AppendValue<uint32_t>(listEntries, tableOffset + tables.size());
+        for (const string &item : items) {
+            AppendValue<uint32_t>(tables, pool.size());
+            AppendValue<uint32_t>(tables, item.size());
+            pool += item;
+        }
+    }
+    string snapshot = "LCS1";
+    const uint32_t version = 2;
+    AppendValue<uint32_t>(snapshot, version);
+    AppendValue<uint32_t>(snapshot, sources.size());
+    AppendValue<uint32_t>(snapshot, lists.size());
+    AppendValue<uint32_t>(snapshot, tableOffset + tables.size());
+    AppendValue<uint32_t>(snapshot, pool.size());
+    for (const string &source : sources) {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for (unsigned char c : source) {
+            hash = (hash ^ c) * FNV_PRIME;
+        }
+        AppendValue<uint64_t>(snapshot, source.size());
+        AppendValue<uint64_t>(snapshot, hash);
+    }
+    return snapshot + listEntries + tables + pool;
+}
+
 /**
  * @tc.name: LocaleConfigFuncTest001
  * @tc.desc: Test LocaleConfig GetSystemLanguage default
@@ -185,4 +240,135 @@ HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest012, TestSize.Level1)
 {
     EXPECT_EQ(LocaleConfig::GetDisplayRegion("zh-Hans", "en-US", true), "China");
 }
+
+/**
+ * @tc.name: LocaleConfigFuncTest013
+ * @tc.desc: Test LocaleConfig GetSystemLocale and GetSystemRegion after the system locale changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest013, TestSize.Level1)
+{
+    if (LocaleConfig::SetSystemLocale("en-GB")) {
+        EXPECT_EQ(LocaleConfig::GetSystemLocale(), "en-GB");
+        EXPECT_EQ(LocaleConfig::GetSystemRegion(), "GB");
+    }
+    if (LocaleConfig::SetSystemRegion("US")) {
+        EXPECT_EQ(LocaleConfig::GetSystemLocale(), "en-US");
+        EXPECT_EQ(LocaleConfig::GetSystemRegion(), "US");
+    }
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest014
+ * @tc.desc: Test LocaleConfig GetDisplayLanguages and GetDisplayRegions
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest014, TestSize.Level1)
+{
+    vector<string> languages = { "en", "de" };
+    vector<string> displayLanguages;
+    LocaleConfig::GetDisplayLanguages(languages, "en-US", true, displayLanguages);
+    ASSERT_EQ(displayLanguages.size(), languages.size());
+    EXPECT_EQ(displayLanguages[1], "German");
+    vector<string> regions = { "CN", "GB" };
+    vector<string> displayRegions;
+    LocaleConfig::GetDisplayRegions(regions, "en-US", true, displayRegions);
+    ASSERT_EQ(displayRegions.size(), regions.size());
+    EXPECT_EQ(displayRegions[0], "China");
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    LocaleConfig::GetDisplayNameCacheStats(hits, misses);
+    EXPECT_EQ(LocaleConfig::GetDisplayRegion("GB", "en-US", true), displayRegions[1]);
+    uint64_t newHits = 0;
+    LocaleConfig::GetDisplayNameCacheStats(newHits, misses);
+    EXPECT_EQ(newHits, hits + 1);
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest015
+ * @tc.desc: Test LocaleConfig IsSuggested for a list of languages
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest015, TestSize.Level1)
+{
+    vector<string> languages = { "zh-Hans", "en", "xx" };
+    vector<bool> flags;
+    LocaleConfig::IsSuggested(languages, "CN", flags);
+    ASSERT_EQ(flags.size(), languages.size());
+    for (size_t i = 0; i < languages.size(); ++i) {
+        EXPECT_EQ(flags[i], LocaleConfig::IsSuggested(languages[i], "CN"));
+    }
+    EXPECT_TRUE(flags[0]);
+    EXPECT_FALSE(flags[2]);
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest016
+ * @tc.desc: Test LocaleConfig GetValidLocale
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest016, TestSize.Level1)
+{
+    if (LocaleConfig::SetSystemLocale("zh-Hans-CN")) {
+        EXPECT_EQ(LocaleConfig::GetValidLocale("en-US"), "en-US");
+        EXPECT_EQ(LocaleConfig::GetValidLocale("en-u-nu-latn-ca-islamic-umalqura"), "en-u-ca-islamic-umalqura-nu-latn");
+        EXPECT_EQ(LocaleConfig::GetValidLocale("en-u-ca-foo-hc-h23"), "en-u-hc-h23");
+        EXPECT_EQ(LocaleConfig::GetValidLocale("ja-JP-u-fw-mon-ca-japanese-x-private"), "ja-JP-u-ca-japanese-fw-mon");
+    }
+}
+
+/**
+ * @tc.name: LocaleConfigFuncTest017
+ * @tc.desc: Test LocaleConfigSnapshot loads a generated snapshot and rejects truncated, corrupt and stale ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleConfigTest, LocaleConfigFuncTest017, TestSize.Level1)
+{
+    string dir = testing::TempDir();
+    vector<string> names = { "supported_regions", "forbidden_regions", "white_languages", "forbidden_languages",
+        "supported_locales" };
+    vector<string> contents = { "<supported_regions><item>CN</item><item>GB</item></supported_regions>",
+        "<forbidden_regions></forbidden_regions>", "<white_languages><item>en</item></white_languages>",
+        "<forbidden_languages></forbidden_languages>",
+        "<supported_locales><item>en-GB</item><item>zh-Hans-CN</item></supported_locales>" };
+    vector<string> paths;
+    for (size_t i = 0; i < names.size(); ++i) {
+        paths.push_back(dir + "snapshot_test_" + names[i] + ".xml");
+        WriteFile(paths[i], contents[i]);
+    }
+    const char *sources[] = { paths[0].c_str(), paths[1].c_str(), paths[2].c_str(), paths[3].c_str(),
+        paths[4].c_str() };
+    uint32_t sourceCount = sizeof(sources) / sizeof(sources[0]);
+    string snapshot = BuildSnapshot(contents, { { "en-GB", "zh-Hans-CN" }, { "CN", "GB" }, { "en" } });
+    string snapshotPath = dir + "snapshot_test.bin";
+    WriteFile(snapshotPath, snapshot);
+    LocaleConfigSnapshot lists;
+    ASSERT_TRUE(lists.Load(snapshotPath.c_str(), sources, sourceCount));
+    EXPECT_EQ(lists.Size(SUPPORTED_LOCALES), 2);
+    EXPECT_EQ(lists.At(SUPPORTED_REGIONS, 1), "GB");
+    EXPECT_TRUE(lists.Contains(SUPPORTED_LOCALES, "zh-Hans-CN"));
+    EXPECT_FALSE(lists.Contains(WHITE_LANGUAGES, "fr"));
+    const size_t truncatedSize = 40;
+    WriteFile(snapshotPath, snapshot.substr(0, truncatedSize));
+    EXPECT_FALSE(lists.Load(snapshotPath.c_str(), sources, sourceCount));
+    EXPECT_EQ(lists.Size(SUPPORTED_LOCALES), 0);
+    string badMagic = snapshot;
+    badMagic[0] = 'X';
+    WriteFile(snapshotPath, badMagic);
+    EXPECT_FALSE(lists.Load(snapshotPath.c_str(), sources, sourceCount));
+    WriteFile(snapshotPath, snapshot);
+    EXPECT_TRUE(lists.Load(snapshotPath.c_str(), sources, sourceCount));
+    // an edit keeping the size of the source makes the snapshot stale as well.
+    WriteFile(paths[0], "<supported_regions><item>CN</item><item>US</item></supported_regions>");
+    EXPECT_FALSE(lists.Load(snapshotPath.c_str(), sources, sourceCount));
+    // the lists parsed from the xml files are assigned then.
+    vector<string> regions = { "US", "CN" };
+    lists.Assign(SUPPORTED_REGIONS, regions);
+    EXPECT_TRUE(lists.Contains(SUPPORTED_REGIONS, "US"));
+    EXPECT_FALSE(lists.Contains(SUPPORTED_REGIONS, "GB"));
+    remove(snapshotPath.c_str());
+    for (const string &path : paths) {
+        remove(path.c_str());
+    }
+}
 } // namespace
\ No newline at end of file
@@ -28,4 +28,9 @@ int LocaleConfigFuncTest009(void);
 int LocaleConfigFuncTest010(void);
 int LocaleConfigFuncTest011(void);
 int LocaleConfigFuncTest012(void);
+int LocaleConfigFuncTest013(void);
+int LocaleConfigFuncTest014(void);
+int LocaleConfigFuncTest015(void);
+int LocaleConfigFuncTest016(void);
+int LocaleConfigFuncTest017(void);
 #endif
\ No newline at end of file
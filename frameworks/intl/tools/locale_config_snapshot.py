@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2022 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compile the locale config xml files into the binary snapshot read by LocaleConfig.
+
+Layout (little endian), must be kept in sync with locale_config_snapshot.h:
+    header:  magic "LCS1", version, sourceCount, listCount, poolOffset, poolSize
+    sources: (uint64 size, uint64 fnv-1a hash) of the content of each source xml, in SOURCE_ORDER
+    lists:   (count, tableOffset) for each list, in LIST_ORDER
+    tables:  (offset, length) of each sorted item inside the string pool
+    pool:    concatenated utf-8 items, not nul terminated
+"""
+
+import argparse
+import struct
+import sys
+import xml.etree.ElementTree as ElementTree
+
+MAGIC = b"LCS1"
+VERSION = 2
+FNV_OFFSET_BASIS = 0xcbf29ce484222325
+FNV_PRIME = 0x100000001b3
+HEADER_FORMAT = "<4sIIIII"
+SOURCE_ORDER = [
+    "supported_regions",
+    "forbidden_regions",
+    "white_languages",
+    "forbidden_languages",
+    "supported_locales",
+]
+LIST_ORDER = ["supported_locales", "supported_regions", "white_languages"]
+
+
+def hash_source(path):
+    with open(path, "rb") as source:
+        content = source.read()
+    value = FNV_OFFSET_BASIS
+    for byte in bytearray(content):
+        value = ((value ^ byte) * FNV_PRIME) & 0xffffffffffffffff
+    return struct.pack("<QQ", len(content), value)
+
+
+def read_list(path, resource_name):
+    root = ElementTree.parse(path).getroot()
+    if root.tag != resource_name:
+        return set()
+    return set((child.text or "").strip() for child in root)
+
+
+def build_lists(sources):
+    regions = read_list(sources["supported_regions"], "supported_regions")
+    regions -= read_list(sources["forbidden_regions"], "forbidden_regions")
+    languages = read_list(sources["white_languages"], "white_languages")
+    languages -= read_list(sources["forbidden_languages"], "forbidden_languages")
+    locales = read_list(sources["supported_locales"], "supported_locales")
+    return {
+        "supported_locales": sorted(locales),
+        "supported_regions": sorted(regions),
+        "white_languages": sorted(languages),
+    }
+
+
+def write_snapshot(output, sources, lists):
+    header_size = struct.calcsize(HEADER_FORMAT)
+    sources_size = 16 * len(SOURCE_ORDER)
+    lists_size = 8 * len(LIST_ORDER)
+    table_offset = header_size + sources_size + lists_size
+    list_entries = b""
+    tables = b""
+    pool = b""
+    for name in LIST_ORDER:
+        items = lists[name]
+        list_entries += struct.pack("<II", len(items), table_offset + len(tables))
+        for item in items:
+            encoded = item.encode("utf-8")
+            tables += struct.pack("<II", len(pool), len(encoded))
+            pool += encoded
+    pool_offset = table_offset + len(tables)
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, len(SOURCE_ORDER), len(LIST_ORDER), pool_offset, len(pool))
+    source_entries = b"".join(hash_source(sources[name]) for name in SOURCE_ORDER)
+    with open(output, "wb") as out:
+        out.write(header + source_entries + list_entries + tables + pool)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    for name in SOURCE_ORDER:
+        parser.add_argument("--" + name.replace("_", "-"), required=True)
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+    sources = dict((name, getattr(args, name)) for name in SOURCE_ORDER)
+    write_snapshot(args.output, sources, build_lists(sources))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
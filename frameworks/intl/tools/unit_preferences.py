@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2022 Huawei Device Co., Ltd.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compile unit_preferences.xml into the constant tables searched by GetUnitPreferences in measure_data.cpp.
+
+Generated tables, the structures are declared in measure_data.h:
+    UNIT_PREFERENCES:     (unit, geq, increment) of every preference, the units of a row are contiguous
+    UNIT_PREFERENCE_ROWS: (usage, region, first, count), sorted by usage then region
+    UNIT_CATEGORIES:      (category, default usage of the category), sorted by category
+where usage is the category and the usage of the xml joined by "-", and increment is the rounding increment of a
+precision-increment skeleton, 0 for a unit without skeleton.
+"""
+
+import argparse
+import sys
+import xml.etree.ElementTree as ElementTree
+
+DEFAULT_GEQ = "1.0"
+INCREMENT_SKELETON = "precision-increment/"
+HEADER = """/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Generated by tools/unit_preferences.py from etc/unit_preferences.xml, do not edit.
+#ifndef OHOS_GLOBAL_I18N_UNIT_PREFERENCES_DATA_H
+#define OHOS_GLOBAL_I18N_UNIT_PREFERENCES_DATA_H
+
+#include "measure_data.h"
+#include "sorted_table.h"
+
+namespace OHOS {
+namespace Global {
+namespace I18n {
+"""
+FOOTER = """} // namespace I18n
+} // namespace Global
+} // namespace OHOS
+#endif
+"""
+
+
+def parse_increment(skeleton):
+    if skeleton is None:
+        return "0"
+    if not skeleton.startswith(INCREMENT_SKELETON) or float(skeleton[len(INCREMENT_SKELETON):]) <= 0:
+        raise ValueError("unsupported skeleton %s" % skeleton)
+    return skeleton[len(INCREMENT_SKELETON):]
+
+
+def read_preferences(path):
+    root = ElementTree.parse(path).getroot()
+    rows = {}
+    categories = set()
+    for preference in root.iter("preference"):
+        category = preference.get("category")
+        usage = category + "-" + preference.get("usage")
+        region = preference.get("region")
+        units = [(unit.text.strip(), unit.get("geq", DEFAULT_GEQ), parse_increment(unit.get("skeleton")))
+            for unit in preference.iter("unit")]
+        if not units or (usage, region) in rows:
+            raise ValueError("invalid preference %s %s" % (usage, region))
+        rows[(usage, region)] = units
+        categories.add(category)
+    for usage, region in rows:
+        if (usage, "001") not in rows:
+            raise ValueError("usage %s has no preference of region 001" % usage)
+    for category in categories:
+        if (category + "-default", "001") not in rows:
+            raise ValueError("category %s has no default preference" % category)
+    return rows, sorted(categories)
+
+
+def write_header(output, rows, categories):
+    preferences = []
+    row_lines = []
+    for usage, region in sorted(rows):
+        units = rows[(usage, region)]
+        row_lines.append('    { "%s", "%s", %d, %d },' % (usage, region, len(preferences), len(units)))
+        preferences.extend(units)
+    lines = [HEADER.rstrip("\n")]
+    lines.append("constexpr UnitPreference UNIT_PREFERENCES[] = {")
+    lines.extend('    { "%s", %s, %s },' % (unit, geq, increment) for unit, geq, increment in preferences)
+    lines.append("};\n")
+    lines.append("constexpr UnitPreferenceRow UNIT_PREFERENCE_ROWS[] = {")
+    lines.extend(row_lines)
+    lines.append("};\n")
+    lines.append("constexpr TableEntry UNIT_CATEGORIES[] = {")
+    lines.extend('    { "%s", "%s-default" },' % (category, category) for category in categories)
+    lines.append("};")
+    lines.append(FOOTER)
+    with open(output, "w") as out:
+        out.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--input", required=True)
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+    rows, categories = read_preferences(args.input)
+    write_header(args.output, rows, categories)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -16,6 +16,7 @@
 #include "zone_util.h"
 #include <algorithm>
 #include <cctype>
+#include <mutex>
 #include "ohos/init_data.h"
 #include "strenum.h"
 #include "unicode/timezone.h"
@@ -59,8 +60,6 @@ unordered_map<string, string> ZoneUtil::defaultMap = {
     {"UZ", "Asia/Tashkent"},
 };
 
-bool ZoneUtil::icuInitialized = ZoneUtil::Init();
-
 string ZoneUtil::GetDefaultZone(const string &country)
 {
     string temp(country);
@@ -209,8 +208,8 @@ void ZoneUtil::GetList(StringEnumeration *strEnum, vector<string> &retVec)
     return;
 }
 
-bool ZoneUtil::Init()
+void ZoneUtil::Init()
 {
-    SetHwIcuDirectory();
-    return true;
+    static once_flag icuDataFlag;
+    call_once(icuDataFlag, SetHwIcuDirectory);
 }
@@ -15,6 +15,7 @@
 #ifndef I18N_ADDON_H
 #define I18N_ADDON_H
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include "napi/native_api.h"
@@ -57,6 +58,9 @@ public:
     static napi_value InitPhoneNumberFormat(napi_env env, napi_value exports);
     static napi_value InitI18nCalendar(napi_env env, napi_value exports);
     static napi_value UnitConvert(napi_env env, napi_callback_info info);
+    static napi_value UnitConvertBatch(napi_env env, napi_callback_info info);
+    static napi_value InitUnitFormatter(napi_env env, napi_value exports);
+    static napi_value GetUnitFormatter(napi_env env, napi_callback_info info);
     static napi_value InitBreakIterator(napi_env env, napi_value exports);
     static napi_value InitIndexUtil(napi_env env, napi_value exports);
     static napi_value IsDigitAddon(napi_env env, napi_callback_info info);
@@ -78,7 +82,10 @@ public:
     static napi_value GetI18nTimeZone(napi_env env, napi_callback_info info);
 
 private:
+    using DisplayNamesFunc = void (*)(const std::vector<std::string> &codes, const std::string &displayLocale,
+        bool sentenceCase, std::vector<std::string> &ret);
     static void CreateInitProperties(napi_property_descriptor *properties);
+    static napi_value GetDisplayNames(napi_env env, napi_value *argv, DisplayNamesFunc func);
     static napi_value PhoneNumberFormatConstructor(napi_env env, napi_callback_info info);
     static napi_value IsValidPhoneNumber(napi_env env, napi_callback_info info);
     static napi_value FormatPhoneNumber(napi_env env, napi_callback_info info);
@@ -124,6 +131,11 @@ private:
     bool InitIndexUtilContext(napi_env env, napi_callback_info info, const std::string &localeTag);
     static napi_value CreateUtilObject(napi_env env);
     static napi_value CreateCharacterObject(napi_env env);
+    static std::shared_ptr<NumberFormat> GetUnitNumberFormat(const std::string &localeTag,
+        std::map<std::string, std::string> &configs);
+    static napi_value UnitFormatterConstructor(napi_env env, napi_callback_info info);
+    static napi_value FormatUnit(napi_env env, napi_callback_info info);
+    bool InitUnitFormatterContext(napi_env env, napi_value *argv);
 
     static napi_value I18nTimeZoneConstructor(napi_env env, napi_callback_info info);
     static napi_value GetID(napi_env env, napi_callback_info info);
@@ -139,6 +151,9 @@ private:
     std::unique_ptr<I18nBreakIterator> brkiter_ = nullptr;
     std::unique_ptr<IndexUtil> indexUtil_ = nullptr;
     std::unique_ptr<I18nTimeZone> timezone_ = nullptr;
+    std::shared_ptr<NumberFormat> unitFormat_ = nullptr;
+    const UnitConversion *unitFrom_ = nullptr;
+    const UnitConversion *unitTo_ = nullptr;
 };
 } // namespace I18n
 } // namespace Global
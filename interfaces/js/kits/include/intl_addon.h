@@ -31,6 +31,10 @@ namespace OHOS {
 namespace Global {
 namespace I18n {
 void GetLocaleTags(napi_env env, napi_value rawLocaleTag, std::vector<std::string> &localeTags);
+bool GetOptionValue(napi_env env, napi_value options, const char *optionName, napi_value &optionValue);
+bool GetStringOptionValue(napi_env env, napi_value options, const char *optionName, std::string &value);
+bool GetIntegerOptionValue(napi_env env, napi_value options, const char *optionName, int64_t &value);
+bool GetBoolOptionValue(napi_env env, napi_value options, const char *optionName, bool &value);
 void GetOptionValue(napi_env env, napi_value options, const std::string &optionName,
     std::map<std::string, std::string> &map);
 void GetBoolOptionValue(napi_env env, napi_value options, const std::string &optionName,
@@ -38,7 +42,7 @@ void GetBoolOptionValue(napi_env env, napi_value options, const std::string &opt
 void GetIntegerOptionValue(napi_env env, napi_value options, const std::string &optionName,
     std::map<std::string, std::string> &map);
 void GetDateOptionValues(napi_env env, napi_value options, std::map<std::string, std::string> &map);
-void GetNumberOptionValues(napi_env env, napi_value options, std::map<std::string, std::string> &map);
+void GetNumberOptionValues(napi_env env, napi_value options, NumberFormatOptions &numberOptions);
 void GetCollatorOptionValue(napi_env env, napi_value options, std::map<std::string, std::string> &map);
 void GetPluralRulesOptionValues(napi_env env, napi_value options, std::map<std::string, std::string> &map);
 void SetOptionProperties(napi_env env, napi_value &result, std::map<std::string, std::string> &options,
@@ -93,6 +97,8 @@ private:
 
     static napi_value GetNumberResolvedOptions(napi_env env, napi_callback_info info);
     static napi_value FormatNumber(napi_env env, napi_callback_info info);
+    static napi_value FormatNumberBatch(napi_env env, napi_callback_info info);
+    static napi_value FormatNumberToParts(napi_env env, napi_callback_info info);
 
     static napi_value CollatorConstructor(napi_env env, napi_callback_info info);
     static napi_value CompareString(napi_env env, napi_callback_info info);
@@ -112,7 +118,7 @@ private:
     bool InitDateTimeFormatContext(napi_env env, napi_callback_info info, std::vector<std::string> localeTags,
         std::map<std::string, std::string> &map);
     bool InitNumberFormatContext(napi_env env, napi_callback_info info, std::vector<std::string> localeTags,
-        std::map<std::string, std::string> &map);
+        const NumberFormatOptions &numberOptions);
     bool InitCollatorContext(napi_env env, napi_callback_info info, std::vector<std::string> localeTags,
         std::map<std::string, std::string> &map);
     bool InitRelativeTimeFormatContext(napi_env env, napi_callback_info info, std::vector<std::string> localeTags,
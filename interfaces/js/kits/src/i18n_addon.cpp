@@ -13,11 +13,13 @@
  * limitations under the License.
  */
 #include <chrono>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 #include "character.h"
 #include "hilog/log.h"
 #include "i18n_calendar.h"
+#include "lru_cache.h"
 #include "node_api.h"
 #include "i18n_addon.h"
 
@@ -29,6 +31,8 @@ static thread_local napi_ref* g_constructor = nullptr;
 static thread_local napi_ref* g_brkConstructor = nullptr;
 static thread_local napi_ref* g_timezoneConstructor = nullptr;
 static thread_local napi_ref g_indexUtilConstructor = nullptr;
+static thread_local napi_ref g_unitFormatterConstructor = nullptr;
+static constexpr size_t UNIT_FORMAT_CACHE_CAPACITY = 16;
 static std::unordered_map<std::string, UCalendarDateFields> g_fieldsMap {
     { "era", UCAL_ERA },
     { "year", UCAL_YEAR },
@@ -158,6 +162,8 @@ napi_value I18nAddon::Init(napi_env env, napi_value exports)
     }
     napi_property_descriptor utilProperties[] = {
         DECLARE_NAPI_FUNCTION("unitConvert", UnitConvert),
+        DECLARE_NAPI_FUNCTION("unitConvertBatch", UnitConvertBatch),
+        DECLARE_NAPI_FUNCTION("getUnitFormatter", GetUnitFormatter),
     };
     status = napi_define_properties(env, util,
                                     sizeof(utilProperties) / sizeof(napi_property_descriptor),
@@ -253,8 +259,6 @@ napi_value I18nAddon::UnitConvert(napi_env env, napi_callback_info info)
         HiLog::Error(LABEL, "Failed to get string item");
         return nullptr;
     }
-    std::vector<std::string> localeTags;
-    localeTags.push_back(localeBuf.data());
     std::map<std::string, std::string> map = {};
     map.insert(std::make_pair("style", "unit"));
     if (!convertStatus) {
@@ -265,8 +269,7 @@ napi_value I18nAddon::UnitConvert(napi_env env, napi_callback_info info)
     }
     // 4 is the index of value
     GetOptionMap(env, argv[4], map);
-    std::unique_ptr<NumberFormat> numberFmt = nullptr;
-    numberFmt = std::make_unique<NumberFormat>(localeTags, map);
+    std::shared_ptr<NumberFormat> numberFmt = GetUnitNumberFormat(localeBuf.data(), map);
     std::string value = numberFmt->Format(number);
     napi_value result;
     status = napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result);
@@ -277,6 +280,223 @@ napi_value I18nAddon::UnitConvert(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value I18nAddon::UnitConvertBatch(napi_env env, napi_callback_info info)
+{
+    size_t argc = 4;
+    napi_value argv[4] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    std::string fromUnit;
+    GetOptionValue(env, argv[0], "unit", fromUnit);
+    std::string fromMeasSys;
+    GetOptionValue(env, argv[0], "measureSystem", fromMeasSys);
+    std::string toUnit;
+    GetOptionValue(env, argv[1], "unit", toUnit);
+    std::string toMeasSys;
+    GetOptionValue(env, argv[1], "measureSystem", toMeasSys);
+    napi_typedarray_type inType = napi_int8_array;
+    size_t inLength = 0;
+    void *in = nullptr;
+    // 2 is the index of the input values
+    napi_status status = napi_get_typedarray_info(env, argv[2], &inType, &inLength, &in, nullptr, nullptr);
+    napi_typedarray_type outType = napi_int8_array;
+    size_t outLength = 0;
+    void *out = nullptr;
+    if (status == napi_ok) {
+        // 3 is the index of the output values
+        status = napi_get_typedarray_info(env, argv[3], &outType, &outLength, &out, nullptr, nullptr);
+    }
+    if (status != napi_ok || inType != napi_float64_array || outType != napi_float64_array || outLength < inLength) {
+        HiLog::Error(LABEL, "Parameter type does not match, Float64Array input and output are required");
+        return nullptr;
+    }
+    // the values are converted inside the array buffers, nothing is crossed per element. views of one buffer that
+    // overlap at different offsets would overwrite inputs before they are read, the input is copied then.
+    const double *inValues = static_cast<const double *>(in);
+    double *outValues = static_cast<double *>(out);
+    uintptr_t inBegin = reinterpret_cast<uintptr_t>(inValues);
+    uintptr_t outBegin = reinterpret_cast<uintptr_t>(outValues);
+    std::vector<double> inCopy;
+    if (inBegin != outBegin && inBegin < outBegin + outLength * sizeof(double) &&
+        outBegin < inBegin + inLength * sizeof(double)) {
+        inCopy.assign(inValues, inValues + inLength);
+        inValues = inCopy.data();
+    }
+    int convertStatus = ConvertBatch(inValues, outValues, inLength, fromUnit, fromMeasSys, toUnit, toMeasSys);
+    if (!convertStatus) {
+        HiLog::Error(LABEL, "Do not support the conversion");
+    }
+    napi_value result = nullptr;
+    status = napi_get_boolean(env, convertStatus != 0, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Create convert status boolean value failed");
+        return nullptr;
+    }
+    return result;
+}
+
+std::shared_ptr<NumberFormat> I18nAddon::GetUnitNumberFormat(const std::string &localeTag,
+    std::map<std::string, std::string> &configs)
+{
+    // an env lives on a single js thread, so the formats are cached per thread and shared by its calls.
+    static thread_local LruCache<std::string, std::shared_ptr<NumberFormat>> formats(UNIT_FORMAT_CACHE_CAPACITY);
+    std::string key = localeTag;
+    for (const auto &config : configs) {
+        key.append(1, '\0').append(config.first).append(1, '=').append(config.second);
+    }
+    std::shared_ptr<NumberFormat> numberFmt = nullptr;
+    if (formats.Get(key, numberFmt)) {
+        return numberFmt;
+    }
+    std::vector<std::string> localeTags;
+    localeTags.push_back(localeTag);
+    numberFmt = std::make_shared<NumberFormat>(localeTags, configs);
+    formats.Put(key, numberFmt);
+    return numberFmt;
+}
+
+napi_value I18nAddon::InitUnitFormatter(napi_env env, napi_value exports)
+{
+    napi_property_descriptor properties[] = {
+        DECLARE_NAPI_FUNCTION("format", FormatUnit)
+    };
+    napi_value constructor = nullptr;
+    napi_status status = napi_define_class(env, "UnitFormatter", NAPI_AUTO_LENGTH, UnitFormatterConstructor,
+        nullptr, sizeof(properties) / sizeof(napi_property_descriptor), properties, &constructor);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Define class failed when InitUnitFormatter");
+        return nullptr;
+    }
+    status = napi_create_reference(env, constructor, 1, &g_unitFormatterConstructor);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create reference at init");
+        return nullptr;
+    }
+    return exports;
+}
+
+napi_value I18nAddon::GetUnitFormatter(napi_env env, napi_callback_info info)
+{
+    size_t argc = 4;
+    napi_value argv[4] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    napi_value constructor = nullptr;
+    napi_status status = napi_get_reference_value(env, g_unitFormatterConstructor, &constructor);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create reference at GetUnitFormatter");
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    status = napi_new_instance(env, constructor, argc, argv, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Get unit formatter create instance failed");
+        return nullptr;
+    }
+    return result;
+}
+
+napi_value I18nAddon::UnitFormatterConstructor(napi_env env, napi_callback_info info)
+{
+    size_t argc = 4;
+    napi_value argv[4] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    // 3 is the number of the required parameters
+    if (argc < 3) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    std::unique_ptr<I18nAddon> obj = nullptr;
+    obj = std::make_unique<I18nAddon>();
+    if (!obj) {
+        HiLog::Error(LABEL, "Create I18nAddon failed");
+        return nullptr;
+    }
+    status =
+        napi_wrap(env, thisVar, reinterpret_cast<void *>(obj.get()), I18nAddon::Destructor, nullptr, &obj->wrapper_);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Wrap I18nAddon failed");
+        return nullptr;
+    }
+    if (!obj->InitUnitFormatterContext(env, argv)) {
+        return nullptr;
+    }
+    obj.release();
+    return thisVar;
+}
+
+bool I18nAddon::InitUnitFormatterContext(napi_env env, napi_value *argv)
+{
+    std::string fromUnit;
+    GetOptionValue(env, argv[0], "unit", fromUnit);
+    std::string fromMeasSys;
+    GetOptionValue(env, argv[0], "measureSystem", fromMeasSys);
+    std::string toUnit;
+    GetOptionValue(env, argv[1], "unit", toUnit);
+    std::string toMeasSys;
+    GetOptionValue(env, argv[1], "measureSystem", toMeasSys);
+    int32_t code = 0;
+    std::string localeTag = GetString(env, argv[2], code); // 2 is the index of locale
+    if (code) {
+        return false;
+    }
+    env_ = env;
+    unitFrom_ = FindUnitConversion(fromUnit, fromMeasSys);
+    unitTo_ = FindUnitConversion(toUnit, toMeasSys);
+    std::map<std::string, std::string> map = {};
+    map.insert(std::make_pair("style", "unit"));
+    if (!unitFrom_ || !unitTo_ || unitFrom_->typeId != unitTo_->typeId) {
+        HiLog::Error(LABEL, "Do not support the conversion");
+        unitFrom_ = nullptr;
+        unitTo_ = nullptr;
+        map.insert(std::make_pair("unit", fromUnit));
+    } else {
+        map.insert(std::make_pair("unit", toUnit));
+    }
+    GetOptionMap(env, argv[3], map); // 3 is the index of style
+    unitFormat_ = GetUnitNumberFormat(localeTag, map);
+    return unitFormat_ != nullptr;
+}
+
+napi_value I18nAddon::FormatUnit(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    I18nAddon *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->unitFormat_) {
+        HiLog::Error(LABEL, "Get UnitFormatter object failed");
+        return nullptr;
+    }
+    double number = 0;
+    status = napi_get_value_double(env, argv[0], &number);
+    if (status != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Parameter type does not match");
+        return nullptr;
+    }
+    if (obj->unitFrom_) {
+        number = ApplyUnitConversion(number, *obj->unitFrom_, *obj->unitTo_);
+    }
+    std::string value = obj->unitFormat_->Format(number);
+    napi_value result = nullptr;
+    status = napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create string item");
+        return nullptr;
+    }
+    return result;
+}
+
 napi_value I18nAddon::IsDigitAddon(napi_env env, napi_callback_info info)
 {
     size_t argc = 1;
@@ -638,6 +858,11 @@ napi_value I18nAddon::GetDisplayLanguage(napi_env env, napi_callback_info info)
     napi_value thisVar = nullptr;
     void *data = nullptr;
     napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    bool isArray = false;
+    napi_is_array(env, argv[0], &isArray);
+    if (isArray) {
+        return GetDisplayNames(env, argv, LocaleConfig::GetDisplayLanguages);
+    }
     size_t len = 0;
     napi_get_value_string_utf8(env, argv[0], nullptr, 0, &len);
     std::vector<char> localeBuf(len + 1);
@@ -677,6 +902,11 @@ napi_value I18nAddon::GetDisplayCountry(napi_env env, napi_callback_info info)
     napi_value thisVar = nullptr;
     void *data = nullptr;
     napi_status status = napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    bool isArray = false;
+    napi_is_array(env, argv[0], &isArray);
+    if (isArray) {
+        return GetDisplayNames(env, argv, LocaleConfig::GetDisplayRegions);
+    }
     size_t len = 0;
     napi_get_value_string_utf8(env, argv[0], nullptr, 0, &len);
     std::vector<char> localeBuf(len + 1);
@@ -707,6 +937,53 @@ napi_value I18nAddon::GetDisplayCountry(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value I18nAddon::GetDisplayNames(napi_env env, napi_value *argv, DisplayNamesFunc func)
+{
+    uint32_t arrayLength = 0;
+    napi_get_array_length(env, argv[0], &arrayLength);
+    std::vector<std::string> codes;
+    int32_t code = 0;
+    for (uint32_t i = 0; i < arrayLength; i++) {
+        napi_value element = nullptr;
+        napi_get_element(env, argv[0], i, &element);
+        codes.push_back(GetString(env, element, code));
+        if (code) {
+            return nullptr;
+        }
+    }
+    std::string displayLocale = GetString(env, argv[1], code);
+    if (code) {
+        return nullptr;
+    }
+    bool sentenceCase = true;
+    int sentenceCaseIndex = 2;
+    if (argv[sentenceCaseIndex] != nullptr) {
+        napi_get_value_bool(env, argv[sentenceCaseIndex], &sentenceCase);
+    }
+    std::vector<std::string> displayNames;
+    func(codes, displayLocale, sentenceCase, displayNames);
+    napi_value result = nullptr;
+    napi_status status = napi_create_array_with_length(env, displayNames.size(), &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create array");
+        return nullptr;
+    }
+    for (size_t i = 0; i < displayNames.size(); i++) {
+        napi_value value = nullptr;
+        status = napi_create_string_utf8(env, displayNames[i].c_str(), NAPI_AUTO_LENGTH, &value);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Failed to create string item");
+            return nullptr;
+        }
+        status = napi_set_element(env, result, i, value);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Failed to set array item");
+            return nullptr;
+        }
+    }
+    return result;
+}
+
 napi_value I18nAddon::IsSuggested(napi_env env, napi_callback_info info)
 {
     // Need to get two parameters to check is suggested or not.
@@ -2678,6 +2955,7 @@ napi_value Init(napi_env env, napi_value exports)
     val = I18nAddon::InitBreakIterator(env, val);
     val = I18nAddon::InitI18nCalendar(env, val);
     val = I18nAddon::InitIndexUtil(env, val);
+    val = I18nAddon::InitUnitFormatter(env, val);
     return I18nAddon::InitI18nTimeZone(env, val);
 }
 
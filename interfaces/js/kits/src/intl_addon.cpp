@@ -143,6 +143,8 @@ napi_value IntlAddon::InitNumberFormat(napi_env env, napi_value exports)
     napi_status status = napi_ok;
     napi_property_descriptor properties[] = {
         DECLARE_NAPI_FUNCTION("format", FormatNumber),
+        DECLARE_NAPI_FUNCTION("formatBatch", FormatNumberBatch),
+        DECLARE_NAPI_FUNCTION("formatToParts", FormatNumberToParts),
         DECLARE_NAPI_FUNCTION("resolvedOptions", GetNumberResolvedOptions)
     };
 
@@ -162,74 +164,81 @@ napi_value IntlAddon::InitNumberFormat(napi_env env, napi_value exports)
     return exports;
 }
 
-void GetOptionValue(napi_env env, napi_value options, const std::string &optionName,
-    std::map<std::string, std::string> &map)
+bool GetOptionValue(napi_env env, napi_value options, const char *optionName, napi_value &optionValue)
 {
-    napi_value optionValue = nullptr;
     napi_valuetype type = napi_undefined;
     napi_status status = napi_typeof(env, options, &type);
     if (status != napi_ok && type != napi_object) {
         HiLog::Error(LABEL, "Get option failed, option is not an object");
-        return;
+        return false;
     }
     bool hasProperty = false;
-    napi_status propStatus = napi_has_named_property(env, options, optionName.c_str(), &hasProperty);
-    if (propStatus == napi_ok && hasProperty) {
-        status = napi_get_named_property(env, options, optionName.c_str(), &optionValue);
-        if (status == napi_ok) {
-            size_t len = 0;
-            napi_get_value_string_utf8(env, optionValue, nullptr, 0, &len);
-            std::vector<char> optionBuf(len + 1);
-            status = napi_get_value_string_utf8(env, optionValue, optionBuf.data(), len + 1, &len);
-            map.insert(make_pair(optionName, optionBuf.data()));
-        }
+    napi_status propStatus = napi_has_named_property(env, options, optionName, &hasProperty);
+    if (propStatus != napi_ok || !hasProperty) {
+        return false;
     }
+    return napi_get_named_property(env, options, optionName, &optionValue) == napi_ok;
 }
 
-void GetIntegerOptionValue(napi_env env, napi_value options, const std::string &optionName,
-    std::map<std::string, std::string> &map)
+bool GetStringOptionValue(napi_env env, napi_value options, const char *optionName, std::string &value)
 {
     napi_value optionValue = nullptr;
-    napi_valuetype type = napi_undefined;
-    napi_status status = napi_typeof(env, options, &type);
-    if (status != napi_ok && type != napi_object) {
-        HiLog::Error(LABEL, "Set option failed, option is not an object");
-        return;
+    if (!GetOptionValue(env, options, optionName, optionValue)) {
+        return false;
     }
-    bool hasProperty = false;
-    napi_status propStatus = napi_has_named_property(env, options, optionName.c_str(), &hasProperty);
-    if (propStatus == napi_ok && hasProperty) {
-        status = napi_get_named_property(env, options, optionName.c_str(), &optionValue);
-        if (status == napi_ok) {
-            int64_t integerValue = -1;
-            status = napi_get_value_int64(env, optionValue, &integerValue);
-            if (status == napi_ok) {
-                map.insert(make_pair(optionName, std::to_string(integerValue)));
-            }
-        }
+    size_t len = 0;
+    napi_get_value_string_utf8(env, optionValue, nullptr, 0, &len);
+    value.resize(len + 1);
+    napi_get_value_string_utf8(env, optionValue, &value[0], len + 1, &len);
+    value.resize(strlen(value.c_str()));
+    return true;
+}
+
+bool GetIntegerOptionValue(napi_env env, napi_value options, const char *optionName, int64_t &value)
+{
+    napi_value optionValue = nullptr;
+    if (!GetOptionValue(env, options, optionName, optionValue)) {
+        return false;
     }
+    return napi_get_value_int64(env, optionValue, &value) == napi_ok;
 }
 
-void GetBoolOptionValue(napi_env env, napi_value options, const std::string &optionName,
-    std::map<std::string, std::string> &map)
+bool GetBoolOptionValue(napi_env env, napi_value options, const char *optionName, bool &value)
 {
     napi_value optionValue = nullptr;
-    napi_valuetype type = napi_undefined;
-    napi_status status = napi_typeof(env, options, &type);
-    if (status != napi_ok && type != napi_object) {
-        HiLog::Error(LABEL, "Set option failed, option is not an object");
-        return;
+    if (!GetOptionValue(env, options, optionName, optionValue)) {
+        return false;
     }
-    bool hasProperty = false;
-    napi_status propStatus = napi_has_named_property(env, options, optionName.c_str(), &hasProperty);
-    if (propStatus == napi_ok && hasProperty) {
-        status = napi_get_named_property(env, options, optionName.c_str(), &optionValue);
-        if (status == napi_ok) {
-            bool boolValue = false;
-            napi_get_value_bool(env, optionValue, &boolValue);
-            std::string value = boolValue ? "true" : "false";
-            map.insert(make_pair(optionName, value));
-        }
+    value = false;
+    napi_get_value_bool(env, optionValue, &value);
+    return true;
+}
+
+void GetOptionValue(napi_env env, napi_value options, const std::string &optionName,
+    std::map<std::string, std::string> &map)
+{
+    std::string value;
+    if (GetStringOptionValue(env, options, optionName.c_str(), value)) {
+        map.insert(make_pair(optionName, value));
+    }
+}
+
+void GetIntegerOptionValue(napi_env env, napi_value options, const std::string &optionName,
+    std::map<std::string, std::string> &map)
+{
+    int64_t integerValue = -1;
+    if (GetIntegerOptionValue(env, options, optionName.c_str(), integerValue)) {
+        map.insert(make_pair(optionName, std::to_string(integerValue)));
+    }
+}
+
+void GetBoolOptionValue(napi_env env, napi_value options, const std::string &optionName,
+    std::map<std::string, std::string> &map)
+{
+    bool boolValue = false;
+    if (GetBoolOptionValue(env, options, optionName.c_str(), boolValue)) {
+        std::string value = boolValue ? "true" : "false";
+        map.insert(make_pair(optionName, value));
     }
 }
 
@@ -521,9 +530,10 @@ napi_value IntlAddon::FormatDateTime(napi_env env, napi_callback_info info)
         return nullptr;
     }
     int64_t date[] = { year, month, day, hour, minute, second };
-    std::string value = obj->datefmt_->Format(date, sizeof(date) / sizeof(int64_t));
+    icu::UnicodeString value;
+    obj->datefmt_->Format(date, sizeof(date) / sizeof(int64_t), value);
     napi_value result = nullptr;
-    status = napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result);
+    status = napi_create_string_utf16(env, value.getBuffer(), value.length(), &result);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Create format string failed");
         return nullptr;
@@ -562,10 +572,11 @@ napi_value IntlAddon::FormatDateTimeRange(napi_env env, napi_callback_info info)
         HiLog::Error(LABEL, "Get DateTimeFormat object failed");
         return nullptr;
     }
-    std::string value = obj->datefmt_->FormatRange(firstDate, sizeof(firstDate) / sizeof(int64_t), secondDate,
-        sizeof(secondDate) / sizeof(int64_t));
+    icu::UnicodeString value;
+    obj->datefmt_->FormatRange(firstDate, sizeof(firstDate) / sizeof(int64_t), secondDate,
+        sizeof(secondDate) / sizeof(int64_t), value);
     napi_value result = nullptr;
-    status = napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result);
+    status = napi_create_string_utf16(env, value.getBuffer(), value.length(), &result);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Create format string failed");
         return nullptr;
@@ -573,26 +584,35 @@ napi_value IntlAddon::FormatDateTimeRange(napi_env env, napi_callback_info info)
     return result;
 }
 
-void GetNumberOptionValues(napi_env env, napi_value options, std::map<std::string, std::string> &map)
+const char *NUMBER_STRING_OPTIONS[] = {
+    "currency", "currencySign", "currencyDisplay", "unit", "unitDisplay", "compactDisplay", "signDisplay",
+    "localeMatcher", "style", "numberingSystem", "notation", "unitUsage"
+};
+
+const char *NUMBER_DIGITS_OPTIONS[] = {
+    "minimumIntegerDigits", "minimumFractionDigits", "maximumFractionDigits", "minimumSignificantDigits",
+    "maximumSignificantDigits"
+};
+
+void GetNumberOptionValues(napi_env env, napi_value options, NumberFormatOptions &numberOptions)
 {
-    GetOptionValue(env, options, "currency", map);
-    GetOptionValue(env, options, "currencySign", map);
-    GetOptionValue(env, options, "currencyDisplay", map);
-    GetOptionValue(env, options, "unit", map);
-    GetOptionValue(env, options, "unitDisplay", map);
-    GetOptionValue(env, options, "compactDisplay", map);
-    GetOptionValue(env, options, "signDisplay", map);
-    GetOptionValue(env, options, "localeMatcher", map);
-    GetOptionValue(env, options, "style", map);
-    GetOptionValue(env, options, "numberingSystem", map);
-    GetOptionValue(env, options, "notation", map);
-    GetOptionValue(env, options, "unitUsage", map);
-    GetBoolOptionValue(env, options, "useGrouping", map);
-    GetIntegerOptionValue(env, options, "minimumIntegerDigits", map);
-    GetIntegerOptionValue(env, options, "minimumFractionDigits", map);
-    GetIntegerOptionValue(env, options, "maximumFractionDigits", map);
-    GetIntegerOptionValue(env, options, "minimumSignificantDigits", map);
-    GetIntegerOptionValue(env, options, "maximumSignificantDigits", map);
+    std::string value;
+    for (const char *optionName : NUMBER_STRING_OPTIONS) {
+        if (GetStringOptionValue(env, options, optionName, value)) {
+            numberOptions.SetOption(optionName, value);
+        }
+    }
+    bool useGrouping = false;
+    if (GetBoolOptionValue(env, options, "useGrouping", useGrouping)) {
+        numberOptions.useGrouping =
+            useGrouping ? NumberFormatOptions::USE_GROUPING_TRUE : NumberFormatOptions::USE_GROUPING_FALSE;
+    }
+    int64_t digits = 0;
+    for (const char *optionName : NUMBER_DIGITS_OPTIONS) {
+        if (GetIntegerOptionValue(env, options, optionName, digits) && digits <= INT32_MAX) {
+            numberOptions.SetDigitsOption(optionName, static_cast<int32_t>(digits));
+        }
+    }
 }
 
 napi_value IntlAddon::NumberFormatConstructor(napi_env env, napi_callback_info info)
@@ -624,9 +644,9 @@ napi_value IntlAddon::NumberFormatConstructor(napi_env env, napi_callback_info i
         }
     }
 
-    std::map<std::string, std::string> map = {};
+    NumberFormatOptions numberOptions;
     if (argv[1] != nullptr) {
-        GetNumberOptionValues(env, argv[1], map);
+        GetNumberOptionValues(env, argv[1], numberOptions);
     }
 
     std::unique_ptr<IntlAddon> obj = nullptr;
@@ -643,7 +663,7 @@ napi_value IntlAddon::NumberFormatConstructor(napi_env env, napi_callback_info i
         return nullptr;
     }
 
-    if (!obj->InitNumberFormatContext(env, info, localeTags, map)) {
+    if (!obj->InitNumberFormatContext(env, info, localeTags, numberOptions)) {
         HiLog::Error(LABEL, "Init NumberFormat failed");
         return nullptr;
     }
@@ -653,7 +673,7 @@ napi_value IntlAddon::NumberFormatConstructor(napi_env env, napi_callback_info i
 }
 
 bool IntlAddon::InitNumberFormatContext(napi_env env, napi_callback_info info, std::vector<std::string> localeTags,
-    std::map<std::string, std::string> &map)
+    const NumberFormatOptions &numberOptions)
 {
     napi_value global = nullptr;
     napi_status status = napi_get_global(env, &global);
@@ -662,7 +682,7 @@ bool IntlAddon::InitNumberFormatContext(napi_env env, napi_callback_info info, s
         return false;
     }
     env_ = env;
-    numberfmt_ = std::make_unique<NumberFormat>(localeTags, map);
+    numberfmt_ = std::make_unique<NumberFormat>(localeTags, numberOptions);
 
     return numberfmt_ != nullptr;
 }
@@ -1321,9 +1341,10 @@ napi_value IntlAddon::FormatNumber(napi_env env, napi_callback_info info)
         HiLog::Error(LABEL, "Get NumberFormat object failed");
         return nullptr;
     }
-    std::string value = obj->numberfmt_->Format(number);
+    icu::UnicodeString value;
+    obj->numberfmt_->Format(number, value);
     napi_value result = nullptr;
-    status = napi_create_string_utf8(env, value.c_str(), NAPI_AUTO_LENGTH, &result);
+    status = napi_create_string_utf16(env, value.getBuffer(), value.length(), &result);
     if (status != napi_ok) {
         HiLog::Error(LABEL, "Create format string failed");
         return nullptr;
@@ -1331,6 +1352,118 @@ napi_value IntlAddon::FormatNumber(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value IntlAddon::FormatNumberBatch(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    napi_typedarray_type type = napi_int8_array;
+    size_t length = 0;
+    void *numbers = nullptr;
+    napi_status status = napi_get_typedarray_info(env, argv[0], &type, &length, &numbers, nullptr, nullptr);
+    if (status != napi_ok || type != napi_float64_array) {
+        HiLog::Error(LABEL, "Parameter type does not match, Float64Array is required");
+        return nullptr;
+    }
+    IntlAddon *obj = nullptr;
+    status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->numberfmt_) {
+        HiLog::Error(LABEL, "Get NumberFormat object failed");
+        return nullptr;
+    }
+    std::string arena;
+    std::vector<size_t> offsets;
+    obj->numberfmt_->FormatBatch(static_cast<const double *>(numbers), length, arena, offsets);
+    if (offsets.size() != length + 1) {
+        HiLog::Error(LABEL, "Format number batch failed");
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    status = napi_create_array_with_length(env, length, &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create array");
+        return nullptr;
+    }
+    for (size_t i = 0; i < length; i++) {
+        napi_value value = nullptr;
+        status = napi_create_string_utf8(env, arena.data() + offsets[i], offsets[i + 1] - offsets[i], &value);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Create format string failed");
+            return nullptr;
+        }
+        status = napi_set_element(env, result, i, value);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Failed to set array item");
+            return nullptr;
+        }
+    }
+    return result;
+}
+
+napi_value CreateNumberPart(napi_env env, const icu::UnicodeString &formatted, const NumberFormatPart &part)
+{
+    napi_value type = nullptr;
+    napi_status status = napi_create_string_utf8(env, NumberFormat::GetPartType(formatted, part), NAPI_AUTO_LENGTH,
+        &type);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    napi_value value = nullptr;
+    status = napi_create_string_utf16(env, formatted.getBuffer() + part.begin, part.end - part.begin, &value);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    napi_value result = nullptr;
+    status = napi_create_object(env, &result);
+    if (status != napi_ok) {
+        return nullptr;
+    }
+    napi_set_named_property(env, result, "type", type);
+    napi_set_named_property(env, result, "value", value);
+    return result;
+}
+
+napi_value IntlAddon::FormatNumberToParts(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = { 0 };
+    napi_value thisVar = nullptr;
+    void *data = nullptr;
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, &data);
+    double number = 0;
+    napi_get_value_double(env, argv[0], &number);
+    IntlAddon *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || !obj || !obj->numberfmt_) {
+        HiLog::Error(LABEL, "Get NumberFormat object failed");
+        return nullptr;
+    }
+    icu::UnicodeString formatted;
+    std::vector<NumberFormatPart> parts;
+    obj->numberfmt_->FormatToParts(number, formatted, parts);
+    napi_value result = nullptr;
+    status = napi_create_array_with_length(env, parts.size(), &result);
+    if (status != napi_ok) {
+        HiLog::Error(LABEL, "Failed to create array");
+        return nullptr;
+    }
+    for (size_t i = 0; i < parts.size(); i++) {
+        napi_value part = CreateNumberPart(env, formatted, parts[i]);
+        if (part == nullptr) {
+            HiLog::Error(LABEL, "Failed to create format part object");
+            return nullptr;
+        }
+        status = napi_set_element(env, result, i, part);
+        if (status != napi_ok) {
+            HiLog::Error(LABEL, "Failed to set array item");
+            return nullptr;
+        }
+    }
+    return result;
+}
+
 void GetCollatorLocaleMatcher(napi_env env, napi_value options, std::map<std::string, std::string> &map)
 {
     GetOptionValue(env, options, "localeMatcher", map);
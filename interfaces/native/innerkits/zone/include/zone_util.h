@@ -30,7 +30,10 @@ public:
     /**
      * default constructor
      */
-    ZoneUtil() : phone_util(*i18n::phonenumbers::PhoneNumberUtil::GetInstance()) {}
+    ZoneUtil() : phone_util(*i18n::phonenumbers::PhoneNumberUtil::GetInstance())
+    {
+        Init();
+    }
 
     /**
      * deconstructor
@@ -96,10 +99,9 @@ public:
 private:
     const i18n::phonenumbers::PhoneNumberUtil &phone_util;
     static std::unordered_map<std::string, std::string> defaultMap;
-    static bool icuInitialized;
     static void GetList(icu::StringEnumeration *strEnum, std::vector<std::string> &ret);
     static void GetString(icu::StringEnumeration *strEnum, std::string &ret);
-    static bool Init();
+    static void Init();
 };
 } // namespace I18n
 } // namespace Global